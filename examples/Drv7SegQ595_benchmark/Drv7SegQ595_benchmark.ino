@@ -0,0 +1,308 @@
+/*************** FILE DESCRIPTION ***************/
+
+/**
+ * Filename: Drv7SegQ595_benchmark.ino
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Purpose:  An example sketch that measures the cost of the Drv7SegQ595
+ *           library on a particular board.
+ *
+ *           Times set_glyph_to_pos() (with and without blank positions
+ *           skipping), output() and output_all() calls for every data
+ *           transfer variant available for the board, with and without
+ *           pipelined shifting, and prints the results
+ *           via UART in CSV format: time and CPU cycles per call,
+ *           maximum achievable refresh rate and CPU share at a given
+ *           refresh rate.
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Notes:    Refer to the README for a general library overview and
+ *           a basic API usage description.
+ *
+ *           Refer to Drv7SegQ595.h for more API details.
+ *
+ *           Anti-ghosting retention is set to zero during the measurements,
+ *           so every output() call outputs a glyph (takes a full slot) and
+ *           every output_all() call outputs a full frame.
+ *
+ *           The results are the same with or without the display connected,
+ *           but don't run the benchmark with pins that are wired to anything
+ *           other than the display circuit.
+ *
+ *           Can also be built and run on a host (PC) against the Arduino core
+ *           mock, see extras/scripts/host_build.sh.
+ */
+
+
+/************ PREPROCESSOR DIRECTIVES ***********/
+
+/*--- Includes ---*/
+
+#include <Drv7SegQ595.h>
+
+// Used to release the SPI pins between the SPI variants.
+#ifdef DRV7SEGQ595_SPI_PROVIDED
+    #include <SPI.h>
+#endif
+
+
+/*--- Drv7SegQ595 library API parameters ---*/
+
+/* Specify appropriately based on your wiring.
+ * Variants that aren't available for your board (device) are skipped automatically.
+ */
+#define POS_SWITCH_TYPE Drv7SegActiveHigh
+
+// Variant for bit-banging.
+#define DATA_PIN  6
+#define LATCH_PIN 7
+#define CLOCK_PIN 8
+
+// Variant for SPI with custom-assigned pins.
+#define MOSI_PIN 6
+#define SCK_PIN  8
+
+/* Variant for USART in SPI mode (AVR only). Uncomment to include it.
+ * The USART mustn't be the one used by Serial (e.g. USART0 of ATmega328P).
+ * XCK_PIN must be the XCKn pin of the chosen USART as per the pin numbering
+ * provided by your Arduino core.
+ */
+//#define BENCH_USART_SPI
+#define USART_NUM 1
+#define XCK_PIN   5
+
+#define POS_1_PIN 10
+#define POS_2_PIN 11
+#define POS_3_PIN 12
+#define POS_4_PIN 9
+
+#define POS_COUNT 4
+
+
+/*--- Misc ---*/
+
+// Set appropriately based on the baud rate you use.
+#define BAUD_RATE 115200
+
+// Number of calls per measurement.
+#define ITERATIONS 1000
+
+// Refresh rate (frames per second) the CPU share is calculated for.
+#define REFRESH_RATE 100
+
+#define MICROS_IN_SEC  1000000UL
+#define NANOS_IN_MICRO 1000UL
+#define NANOS_IN_SEC   1000000000UL
+
+// CPU clock frequency, if provided by the Arduino core.
+#ifdef F_CPU
+    #define CPU_HZ F_CPU
+#else
+    #define CPU_HZ 0  // Unknown, cycles per call won't be reported.
+#endif
+
+/* Pseudo-glyph assigned to every position.
+ * set_glyph_to_pos() alternates it with a glyph differing in the lowest bit, otherwise every call
+ * but the first one per position would return early with the glyph unchanged.
+ */
+#define GLYPH 0b01011011
+
+
+/******************* FUNCTIONS ******************/
+
+/* Print a single CSV row.
+ *
+ * calls_per_frame is the number of calls that output a full frame (all positions output once),
+ * zero if not applicable to the method.
+ */
+void print_row(const char *variant, const char *method, uint32_t total_us, uint32_t calls_per_frame)
+{
+    // Float arithmetic, so total_us * NANOS_IN_MICRO doesn't overflow 32 bits for runs above about 4.3 seconds.
+    float ns_per_call  = static_cast<float>(total_us) * NANOS_IN_MICRO / ITERATIONS;
+    float per_frame_ns = ns_per_call * calls_per_frame;
+
+    Serial.print(variant);
+    Serial.print(',');
+    Serial.print(method);
+    Serial.print(',');
+    Serial.print(ITERATIONS);
+    Serial.print(',');
+    Serial.print(total_us);
+    Serial.print(',');
+    Serial.print(ns_per_call, 0);
+    Serial.print(',');
+    if (CPU_HZ > 0) {
+        // Float division, so clocks that aren't whole megahertz (e.g. 7.3728 MHz) aren't truncated.
+        Serial.print(static_cast<float>(total_us) * (CPU_HZ / static_cast<float>(MICROS_IN_SEC)) / ITERATIONS, 1);
+    }
+    Serial.print(',');
+    if (per_frame_ns > 0) {
+        Serial.print(NANOS_IN_SEC / per_frame_ns, 0);
+    }
+    Serial.print(',');
+    if (per_frame_ns > 0) {
+        Serial.print(100.0f * REFRESH_RATE * per_frame_ns / NANOS_IN_SEC, 2);
+    }
+    Serial.println();
+}
+
+// Measure all methods for the currently configured variant.
+void bench_variant(const char *variant)
+{
+    if (Drv7Seg.get_status() < 0) {
+        Serial.print("# ");
+        Serial.print(variant);
+        Serial.print(": driver configuration failed, error code ");
+        Serial.println(Drv7Seg.get_status());
+        return;
+    }
+
+    Drv7Seg.set_anti_ghosting_retention_duration(0);
+
+    uint32_t start_us;
+    uint32_t total_us;
+
+
+    /*--- set_glyph_to_pos() ---*/
+
+    start_us = micros();
+    for (uint32_t i = 0; i < ITERATIONS; ++i) {
+        uint8_t glyph = GLYPH ^ ((i / POS_COUNT) & 1);  // Changes once every position has been assigned.
+        Drv7Seg.set_glyph_to_pos(glyph, static_cast<Drv7SegQ595Class::Pos>(i % POS_COUNT + 1));
+    }
+    total_us = micros() - start_us;
+    print_row(variant, "set_glyph_to_pos", total_us, 0);
+
+    // With blank positions skipping every glyph change also updates the rotation.
+    Drv7Seg.set_blank_pos_skipping(true);
+    start_us = micros();
+    for (uint32_t i = 0; i < ITERATIONS; ++i) {
+        uint8_t glyph = GLYPH ^ ((i / POS_COUNT) & 1);  // Changes once every position has been assigned.
+        Drv7Seg.set_glyph_to_pos(glyph, static_cast<Drv7SegQ595Class::Pos>(i % POS_COUNT + 1));
+    }
+    total_us = micros() - start_us;
+    Drv7Seg.set_blank_pos_skipping(false);
+    print_row(variant, "set_glyph_to_pos_skipping", total_us, 0);
+
+
+    /*--- output(), a single slot per call ---*/
+
+    start_us = micros();
+    for (uint32_t i = 0; i < ITERATIONS; ++i) {
+        Drv7Seg.output(GLYPH, static_cast<Drv7SegQ595Class::Pos>(i % POS_COUNT + 1));
+    }
+    total_us = micros() - start_us;
+    // A frame takes POS_COUNT slots.
+    print_row(variant, "output", total_us, POS_COUNT);
+
+
+    /*--- output_all(), a full frame per call ---*/
+
+    for (uint32_t i = 0; i < POS_COUNT; ++i) {
+        Drv7Seg.set_glyph_to_pos(GLYPH, static_cast<Drv7SegQ595Class::Pos>(i + 1));
+    }
+
+    start_us = micros();
+    for (uint32_t i = 0; i < ITERATIONS; ++i) {
+        Drv7Seg.output_all();
+    }
+    total_us = micros() - start_us;
+    print_row(variant, "output_all", total_us, 1);
+}
+
+// Measure a variant with and without pipelined shifting.
+void bench_variant_both_modes(const char *variant, const char *variant_pipelined)
+{
+    Drv7Seg.set_pipelined_shifting(false);
+    bench_variant(variant);
+
+    Drv7Seg.set_pipelined_shifting(true);
+    bench_variant(variant_pipelined);
+
+    Drv7Seg.set_pipelined_shifting(false);
+}
+
+void setup()
+{
+    Serial.begin(BAUD_RATE);
+    while (!Serial) {
+        // Wait for the native USB serial port to connect (if applicable).
+    }
+
+
+    /*--- Report header ---*/
+
+    Serial.println("# Drv7SegQ595 benchmark");
+    Serial.print("# cpu_hz=");
+    Serial.print(static_cast<uint32_t>(CPU_HZ));
+    Serial.print(",positions=");
+    Serial.print(POS_COUNT);
+    Serial.print(",iterations=");
+    Serial.print(ITERATIONS);
+    Serial.print(",refresh_rate_hz=");
+    Serial.println(REFRESH_RATE);
+    Serial.println("variant,method,iterations,total_us,ns_per_call,cycles_per_call,max_refresh_hz,cpu_share_pct");
+
+
+    /*--- Bit-banging ---*/
+
+    #ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+    Drv7Seg.begin_bb(POS_SWITCH_TYPE,
+                     DATA_PIN, LATCH_PIN, CLOCK_PIN,
+                     POS_1_PIN,
+                     POS_2_PIN,
+                     POS_3_PIN,
+                     POS_4_PIN
+                    );
+    bench_variant_both_modes("bb", "bb_pipelined");
+    #endif
+
+
+    /*--- SPI with default pins ---*/
+
+    #ifdef DRV7SEGQ595_SPI_PROVIDED
+    Drv7Seg.begin_spi(POS_SWITCH_TYPE,
+                      LATCH_PIN,
+                      POS_1_PIN,
+                      POS_2_PIN,
+                      POS_3_PIN,
+                      POS_4_PIN
+                     );
+    bench_variant_both_modes("spi", "spi_pipelined");
+    SPI.end();
+    #endif
+
+
+    /*--- SPI with custom-assigned pins ---*/
+
+    #ifdef DRV7SEGQ595_SPI_PROVIDED_CUSTOM_PINS
+    Drv7Seg.begin_spi_custom_pins(POS_SWITCH_TYPE,
+                                  MOSI_PIN, LATCH_PIN, SCK_PIN,
+                                  POS_1_PIN,
+                                  POS_2_PIN,
+                                  POS_3_PIN,
+                                  POS_4_PIN
+                                 );
+    bench_variant_both_modes("spi_custom", "spi_custom_pipelined");
+    SPI.end();
+    #endif
+
+
+    /*--- USART in SPI mode ---*/
+
+    #if defined(DRV7SEGQ595_USART_SPI_PROVIDED) && defined(BENCH_USART_SPI)
+    Drv7Seg.begin_usart_spi(POS_SWITCH_TYPE,
+                            USART_NUM, LATCH_PIN, XCK_PIN,
+                            POS_1_PIN,
+                            POS_2_PIN,
+                            POS_3_PIN,
+                            POS_4_PIN
+                           );
+    bench_variant_both_modes("usart_spi", "usart_spi_pipelined");
+    #endif
+
+    Serial.println("# done");
+}
+
+void loop()
+{
+    // Nothing to do, the benchmark runs once.
+}
@@ -14,6 +14,8 @@
  *           The dot segment (decimal point, DP) of the second character
  *           position (second digit, where the minutes' ones are output)
  *           blinks (toggles ON or OFF) once per second (at 0.5 Hz).
+ *           Blinking is handled by the driver itself via position attributes,
+ *           so the glyphs don't need to be regenerated for that.
  * ----------------------------------------------------------------------------|---------------------------------------|
  * Notes:    Refer to the README for a general library overview and
  *           a basic API usage description.
@@ -51,10 +53,15 @@
  * SPI variant with custom-assigned pins is only available for those hardware platforms
  * that support custom SPI pins assignment and have an SPI.h implementation that reflects
  * such support (as of the last library update those are ESP32 and STM32).
+ *
+ * USART in SPI mode variant is only available for AVR MCs. The chosen USART cannot be used
+ * by Serial at the same time (e.g. on ATmega328P the only USART is USART0, which Serial uses),
+ * so comment out SERIAL_OUTPUT_TIMER_VALUES below if necessary.
  */
 #define USE_BIT_BANGING
 //#define USE_SPI_DEFAULT_PINS
 //#define USE_SPI_CUSTOM_PINS
+//#define USE_USART_SPI
 
 /* Specify the signal level that turns on the character positions of your display.
  * Use one variant, comment out or delete the other.
@@ -81,6 +88,15 @@
     #define SCK_PIN   8
 #endif
 
+/* Specify appropriately based on your wiring. Variant for USART in SPI mode.
+ * TXDn pin of the chosen USART becomes the data pin, XCKn pin becomes the clock pin.
+ */
+#ifdef USE_USART_SPI
+    #define USART_NUM 0
+    #define LATCH_PIN 7
+    #define XCK_PIN   4
+#endif
+
 /* Specify appropriately based on which digital pins control
  * the character positions of your 7-segment display.
  *
@@ -100,6 +116,9 @@
 // (optional) Set a non-default anti-ghosting retention duration value (in microseconds).
 #define ANTI_GHOSTING_RETENTION_DURATION 1000
 
+// Full blink cycle duration (in milliseconds). Dot segment is ON for one half and OFF for another.
+#define BLINK_PERIOD 2000
+
 
 /*--- SegMap595 library API parameters ---*/
 
@@ -205,6 +224,16 @@ void setup()
                                  );
     #endif
 
+    #ifdef USE_USART_SPI
+    Drv7Seg.begin_usart_spi(POS_SWITCH_TYPE,
+                            USART_NUM, LATCH_PIN, XCK_PIN,
+                            POS_1_PIN,
+                            POS_2_PIN,
+                            POS_3_PIN,
+                            POS_4_PIN
+                           );
+    #endif
+
     /* Driver configuration status check.
      * You can also check the value returned by begin_*() instead of calling get_status().
      */
@@ -222,6 +251,23 @@ void setup()
     #ifdef ANTI_GHOSTING_RETENTION_DURATION
     Drv7Seg.set_anti_ghosting_retention_duration(ANTI_GHOSTING_RETENTION_DURATION);
     #endif
+
+
+    /*--- Position attributes ---*/
+
+    /* A byte with all segments turned OFF. Derived from the mapped glyph '8'
+     * (all segments except the dot turned ON) so that it matches the display type.
+     */
+    uint8_t blank_glyph = ~SegMap595.toggle_dot(SegMap595.get_mapped_byte(8));
+    Drv7Seg.set_blank_glyph(blank_glyph);
+
+    // A byte with only the dot segment bit set, regardless of the display type.
+    uint8_t dot_mask = SegMap595.toggle_dot(0x00);
+
+    // Dot-segment blink.
+    Drv7Seg.set_forced_segments_to_pos(dot_mask, Drv7SegPos2);
+    Drv7Seg.set_blink_to_pos(dot_mask, Drv7SegPos2);
+    Drv7Seg.set_blink_period(BLINK_PERIOD);
 }
 
 void loop()
@@ -256,11 +302,6 @@ void loop()
         uint8_t seg_byte_seconds_tens = SegMap595.get_mapped_byte(counter_seconds / 10);
         uint8_t seg_byte_seconds_ones = SegMap595.get_mapped_byte(counter_seconds % 10);
 
-        // Dot-segment blink.
-        if (counter_seconds % 2) {
-            seg_byte_minutes_ones = SegMap595.toggle_dot(seg_byte_minutes_ones);
-        }
-
         Drv7Seg.set_glyph_to_pos(seg_byte_minutes_tens, Drv7SegPos1);
         Drv7Seg.set_glyph_to_pos(seg_byte_minutes_ones, Drv7SegPos2);
         Drv7Seg.set_glyph_to_pos(seg_byte_seconds_tens, Drv7SegPos3);
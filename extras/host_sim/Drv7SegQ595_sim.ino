@@ -0,0 +1,434 @@
+/*************** FILE DESCRIPTION ***************/
+
+/**
+ * Filename: Drv7SegQ595_sim.ino
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Purpose:  A host (PC) simulation of the Drv7SegQ595 multiplexing timing.
+ *
+ *           First runs a set of checks against the mock timebase: the
+ *           retention is honoured in ticks, the blink phase toggles every
+ *           half-period, and both keep working across the wraparound
+ *           of the tick counter at 2^32.
+ *
+ *           Then runs output_all() for one second of simulated time per
+ *           scenario and prints via Serial (to stdout) in CSV format how
+ *           long each character position actually stayed turned on, next
+ *           to the nominal slot share and the measured duty reported by
+ *           the driver (the latter must agree with the former). Scenarios
+ *           compare plain and pipelined shifting (the latter must keep
+ *           the display lit for longer), and blank positions skipping
+ *           turned off and on (the frame period must stay the same).
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Notes:    Host only, relies on the Arduino core mock (extras/mock_core).
+ *           Build and run with:
+ *           extras/scripts/host_build.sh extras/host_sim/Drv7SegQ595_sim.ino
+ *
+ *           Exits with a non-zero status if any check fails, so it can
+ *           serve as a host test. Checks and scenarios of a data transfer
+ *           variant stripped by the footprint-minimized profile are skipped.
+ *
+ *           In the scenarios every digitalWrite() and SPI.transfer() call
+ *           advances the mock timebase by a fixed cost, roughly as on
+ *           an ATmega328P at 16 MHz, so the time the display stays dark
+ *           while the data is shifted is accounted for.
+ */
+
+
+/************ PREPROCESSOR DIRECTIVES ***********/
+
+/*--- Includes ---*/
+
+#include <stdlib.h>
+
+#include <Drv7SegQ595.h>
+#include <SPI.h>
+#include <mock_timebase.h>
+
+
+/*--- Drv7SegQ595 library API parameters ---*/
+
+#define DATA_PIN  6
+#define LATCH_PIN 7
+#define CLOCK_PIN 8
+
+#define POS_COUNT 4
+
+const uint8_t pos_pins[POS_COUNT] = {10, 11, 12, 9};
+
+
+/*--- Checks ---*/
+
+// Deliberately not 1 MHz, so the conversion of durations to ticks gets checked too.
+#define CHECK_TICKS_PER_SEC 2000000u
+
+#define CHECK_RETENTION_DURATION 600  // Microseconds.
+#define CHECK_RETENTION_TICKS    (CHECK_RETENTION_DURATION * (CHECK_TICKS_PER_SEC / 1000000u))
+
+#define CHECK_BLINK_PERIOD            10  // Milliseconds.
+#define CHECK_BLINK_HALF_PERIOD_TICKS (CHECK_BLINK_PERIOD * (CHECK_TICKS_PER_SEC / 1000u) / 2)
+#define CHECK_BLINK_HALF_PERIODS      8
+
+// Frame period of the checks, the blink phase change shows up on position 1 within a frame.
+#define CHECK_FRAME_TICKS (CHECK_RETENTION_TICKS * POS_COUNT)
+
+#define CHECK_STEP_TICKS 100
+
+// Starts the checks close enough to 2^32 for the tick counter to wrap around during them.
+#define CHECK_WRAP_START (UINT32_MAX - CHECK_RETENTION_TICKS / 2)
+
+
+/*--- Scenarios ---*/
+
+// Simulated costs (in mock timebase ticks, i.e. microseconds).
+#define DIGITAL_WRITE_TICKS 4
+#define SPI_TRANSFER_TICKS  3
+#define LOOP_TICKS          1  // Whatever else the main loop does between output_all() calls.
+
+// Simulated duration of every scenario.
+#define SCENARIO_TICKS MOCK_TIMEBASE_TICKS_PER_SEC
+
+#define PER_MILLE 1000
+
+// Maximum difference between the frame periods with and without blank positions skipping, in per mille.
+#define FRAME_PERIOD_TOLERANCE_PM 10
+
+// Maximum difference between the duty measured by the driver over its last frame
+// and the on-time measured by the mock over the whole scenario.
+#define DUTY_TOLERANCE_PM 10
+
+// Segment bytes for "1234" and "  42" (common cathode, segment A is the LSB).
+const uint8_t glyphs_all_lit[POS_COUNT]       = {0x06, 0x5B, 0x4F, 0x66};
+const uint8_t glyphs_leading_blank[POS_COUNT] = {0x00, 0x00, 0x66, 0x5B};
+
+
+/*************** GLOBAL VARIABLES ***************/
+
+uint32_t failures = 0;
+
+// Frames (switch-ons of the last position, lit in every scenario) counted by the last run_scenario().
+uint32_t scenario_frames = 0;
+
+
+/******************* FUNCTIONS ******************/
+
+/*--- Helpers ---*/
+
+// Count and report a failed check.
+void check(bool passed, const char *what, uint32_t start_ticks)
+{
+    if (!passed) {
+        Serial.print("# FAIL: ");
+        Serial.print(what);
+        Serial.print(", start ticks ");
+        Serial.println(static_cast<unsigned long>(start_ticks));
+        ++failures;
+    }
+}
+
+// Returns the number of the position that is turned on, zero if none.
+uint8_t lit_pos()
+{
+    for (uint8_t i = 0; i < POS_COUNT; ++i) {
+        if (mock_timebase_pin_level(pos_pins[i]) == HIGH) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+// Assign the same glyph to every position.
+void set_glyph_to_all(uint8_t seg_byte)
+{
+    for (uint8_t i = 0; i < POS_COUNT; ++i) {
+        Drv7Seg.set_glyph_to_pos(seg_byte, static_cast<Drv7SegQ595Class::Pos>(i + 1));
+    }
+}
+
+
+/*--- Checks ---*/
+
+#ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+// The next position must be turned on exactly when the retention elapses.
+void check_retention(uint32_t start_ticks)
+{
+    mock_timebase_set(start_ticks);
+    Drv7Seg.begin_bb(Drv7SegActiveHigh,
+                     DATA_PIN, LATCH_PIN, CLOCK_PIN,
+                     pos_pins[0],
+                     pos_pins[1],
+                     pos_pins[2],
+                     pos_pins[3]
+                    );
+    Drv7Seg.set_timebase(mock_timebase_ticks, CHECK_TICKS_PER_SEC);
+    Drv7Seg.set_anti_ghosting_retention_duration(CHECK_RETENTION_DURATION);
+
+    Drv7Seg.output_all();
+    check(lit_pos() == 1, "retention: position 1 isn't turned on by the first call", start_ticks);
+
+    mock_timebase_advance(CHECK_RETENTION_TICKS - 1);
+    Drv7Seg.output_all();
+    check(lit_pos() == 1, "retention: ends a tick early", start_ticks);
+
+    mock_timebase_advance(1);
+    Drv7Seg.output_all();
+    check(lit_pos() == 2, "retention: doesn't end when elapsed", start_ticks);
+
+    mock_timebase_advance(CHECK_RETENTION_TICKS);
+    Drv7Seg.output_all();
+    check(lit_pos() == 3, "retention: second slot doesn't end when elapsed", start_ticks);
+}
+#endif
+
+#ifdef DRV7SEGQ595_SPI_PROVIDED
+// The blinking segments must toggle once per half-period.
+void check_blink(uint32_t start_ticks)
+{
+    mock_timebase_set(start_ticks);
+    Drv7Seg.begin_spi(Drv7SegActiveHigh,
+                      LATCH_PIN,
+                      pos_pins[0],
+                      pos_pins[1],
+                      pos_pins[2],
+                      pos_pins[3]
+                     );
+    Drv7Seg.set_timebase(mock_timebase_ticks, CHECK_TICKS_PER_SEC);
+    Drv7Seg.set_anti_ghosting_retention_duration(CHECK_RETENTION_DURATION);
+    Drv7Seg.set_blink_period(CHECK_BLINK_PERIOD);
+
+    set_glyph_to_all(0xFF);
+    Drv7Seg.set_blink_to_pos(0xFF, Drv7SegPos1);
+
+    uint8_t  previous_lit_pos  = 0;
+    bool     first_slot        = true;
+    uint8_t  previous_seg_byte = 0;
+    uint32_t previous_toggle   = start_ticks;
+    uint32_t toggles           = 0;
+    bool     spacing_ok        = true;
+
+    while (mock_timebase_ticks() - start_ticks < CHECK_BLINK_HALF_PERIODS * CHECK_BLINK_HALF_PERIOD_TICKS) {
+        Drv7Seg.output_all();
+
+        // Without pipelined shifting the last byte sent is the one latched when a position gets turned on.
+        uint8_t current_lit_pos = lit_pos();
+        if (current_lit_pos == 1 && previous_lit_pos != 1) {
+            // The blink phase persists through reconfiguration, so the first slot only sets the reference.
+            uint8_t seg_byte = mock_spi_last_byte();
+            if (first_slot) {
+                first_slot        = false;
+                previous_seg_byte = seg_byte;
+            } else if (seg_byte != previous_seg_byte) {
+                uint32_t spacing = mock_timebase_ticks() - previous_toggle;
+                if (spacing + CHECK_FRAME_TICKS < CHECK_BLINK_HALF_PERIOD_TICKS ||
+                    spacing > CHECK_BLINK_HALF_PERIOD_TICKS + CHECK_FRAME_TICKS) {
+                    spacing_ok = false;
+                }
+
+                previous_seg_byte = seg_byte;
+                previous_toggle   = mock_timebase_ticks();
+                ++toggles;
+            }
+        }
+        previous_lit_pos = current_lit_pos;
+
+        mock_timebase_advance(CHECK_STEP_TICKS);
+    }
+
+    check(spacing_ok, "blink: toggles aren't a half-period apart", start_ticks);
+    check(toggles + 1 >= CHECK_BLINK_HALF_PERIODS, "blink: too few toggles", start_ticks);
+
+    Drv7Seg.set_blink_to_pos(0x00, Drv7SegPos1);
+    SPI.end();
+}
+#endif
+
+
+/*--- Scenarios ---*/
+
+/* Check that skipping the blank positions keeps the frame period.
+ *
+ * Returns: nothing.
+ */
+void check_frame_period(uint32_t frames, uint32_t frames_skipped, const char *what)
+{
+    Serial.print("# frames per second: ");
+    Serial.print(static_cast<unsigned long>(frames));
+    Serial.print(" unskipped, ");
+    Serial.print(static_cast<unsigned long>(frames_skipped));
+    Serial.println(" skipped");
+
+    uint32_t difference = frames > frames_skipped ? frames - frames_skipped : frames_skipped - frames;
+    check(difference * PER_MILLE <= frames * FRAME_PERIOD_TOLERANCE_PM, what, 0);
+}
+
+/* Assign the glyphs, run output_all() for SCENARIO_TICKS and print the results.
+ *
+ * Returns: the share of time any position was turned on, in per mille.
+ */
+uint32_t run_scenario(const char *scenario, const uint8_t *glyphs)
+{
+    for (uint8_t i = 0; i < POS_COUNT; ++i) {
+        Drv7Seg.set_glyph_to_pos(glyphs[i], static_cast<Drv7SegQ595Class::Pos>(i + 1));
+    }
+
+    mock_timebase_pin_high_ticks_reset();
+    scenario_frames = 0;
+    uint8_t  last_pos_level = mock_timebase_pin_level(pos_pins[POS_COUNT - 1]);
+    uint32_t start_ticks    = mock_timebase_ticks();
+    while (mock_timebase_ticks() - start_ticks < SCENARIO_TICKS) {
+        Drv7Seg.output_all();
+        mock_timebase_advance(LOOP_TICKS);
+
+        uint8_t level = mock_timebase_pin_level(pos_pins[POS_COUNT - 1]);
+        if (level == HIGH && last_pos_level == LOW) {
+            ++scenario_frames;
+        }
+        last_pos_level = level;
+    }
+    uint32_t total_ticks = mock_timebase_ticks() - start_ticks;
+
+    uint32_t lit_ticks = 0;
+    uint32_t lit_duty  = 0;
+    for (uint8_t i = 0; i < POS_COUNT; ++i) {
+        uint32_t on_ticks = mock_timebase_pin_high_ticks(pos_pins[i]);
+        lit_ticks += on_ticks;
+
+        uint32_t on_time = static_cast<unsigned long>(on_ticks) * PER_MILLE / total_ticks;
+        int16_t  duty    = Drv7Seg.get_duty_of_pos(static_cast<Drv7SegQ595Class::Pos>(i + 1));
+
+        Serial.print(scenario);
+        Serial.print(',');
+        Serial.print(i + 1);
+        Serial.print(',');
+        Serial.print(static_cast<unsigned long>(on_time));
+        Serial.print(',');
+        Serial.print(Drv7Seg.get_slot_share_of_pos(static_cast<Drv7SegQ595Class::Pos>(i + 1)));
+        Serial.print(',');
+        Serial.println(duty);
+        lit_duty += duty;
+
+        check(abs(static_cast<int32_t>(on_time) - duty) <= DUTY_TOLERANCE_PM,
+              "measured duty doesn't match the on-time", 0);
+    }
+
+    uint32_t lit_share = static_cast<unsigned long>(lit_ticks) * PER_MILLE / total_ticks;
+
+    Serial.print(scenario);
+    Serial.print(",all,");
+    Serial.print(static_cast<unsigned long>(lit_share));
+    Serial.print(',');
+    Serial.print(PER_MILLE);
+    Serial.print(',');
+    Serial.println(static_cast<unsigned long>(lit_duty));
+
+    return lit_share;
+}
+
+void run_scenarios()
+{
+    Serial.println("scenario,pos,on_time_pm,slot_share_pm,duty_pm");
+
+    mock_timebase_set(0);
+    mock_timebase_digital_write_ticks = DIGITAL_WRITE_TICKS;
+    mock_timebase_spi_transfer_ticks  = SPI_TRANSFER_TICKS;
+
+    uint32_t lit_share;
+    uint32_t frames;
+
+
+    /*--- Bit-banging ---*/
+
+    #ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+    Drv7Seg.begin_bb(Drv7SegActiveHigh,
+                     DATA_PIN, LATCH_PIN, CLOCK_PIN,
+                     pos_pins[0],
+                     pos_pins[1],
+                     pos_pins[2],
+                     pos_pins[3]
+                    );
+    Drv7Seg.set_timebase(mock_timebase_ticks, MOCK_TIMEBASE_TICKS_PER_SEC);
+    Drv7Seg.set_anti_ghosting_retention_duration(DRV7SEGQ595_ANTI_GHOSTING_DEFAULT_RETENTION_DURATION);
+
+    lit_share = run_scenario("bb", glyphs_all_lit);
+
+    // Preloading the next slot during the retention must shorten the dark time.
+    Drv7Seg.set_pipelined_shifting(true);
+    check(run_scenario("bb_pipelined", glyphs_all_lit) > lit_share,
+          "pipelined shifting: no gain with bit-banging", 0);
+    Drv7Seg.set_pipelined_shifting(false);
+
+    run_scenario("bb_leading_blank", glyphs_leading_blank);
+    frames = scenario_frames;
+
+    Drv7Seg.set_blank_pos_skipping(true);
+    run_scenario("bb_leading_blank_skipped", glyphs_leading_blank);
+    Drv7Seg.set_blank_pos_skipping(false);
+    check_frame_period(frames, scenario_frames, "blank positions skipping: frame period changed with bit-banging");
+    #endif
+
+
+    /*--- SPI ---*/
+
+    #ifdef DRV7SEGQ595_SPI_PROVIDED
+    Drv7Seg.begin_spi(Drv7SegActiveHigh,
+                      LATCH_PIN,
+                      pos_pins[0],
+                      pos_pins[1],
+                      pos_pins[2],
+                      pos_pins[3]
+                     );
+    Drv7Seg.set_timebase(mock_timebase_ticks, MOCK_TIMEBASE_TICKS_PER_SEC);
+    Drv7Seg.set_anti_ghosting_retention_duration(DRV7SEGQ595_ANTI_GHOSTING_DEFAULT_RETENTION_DURATION);
+
+    lit_share = run_scenario("spi", glyphs_all_lit);
+
+    Drv7Seg.set_pipelined_shifting(true);
+    check(run_scenario("spi_pipelined", glyphs_all_lit) > lit_share,
+          "pipelined shifting: no gain with SPI", 0);
+    Drv7Seg.set_pipelined_shifting(false);
+
+    run_scenario("spi_leading_blank", glyphs_leading_blank);
+    frames = scenario_frames;
+
+    Drv7Seg.set_blank_pos_skipping(true);
+    run_scenario("spi_leading_blank_skipped", glyphs_leading_blank);
+    Drv7Seg.set_blank_pos_skipping(false);
+    check_frame_period(frames, scenario_frames, "blank positions skipping: frame period changed with SPI");
+    #endif
+}
+
+void setup()
+{
+    /*--- Checks ---*/
+
+    #ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+    check_retention(0);
+    check_retention(CHECK_WRAP_START);
+    #endif
+
+    #ifdef DRV7SEGQ595_SPI_PROVIDED
+    check_blink(0);
+    check_blink(CHECK_WRAP_START);
+    #endif
+
+
+    /*--- Scenarios ---*/
+
+    run_scenarios();
+
+
+    /*--- Result ---*/
+
+    if (failures > 0) {
+        Serial.print("# checks failed: ");
+        Serial.println(static_cast<unsigned long>(failures));
+        exit(EXIT_FAILURE);
+    }
+
+    Serial.println("# all checks passed");
+}
+
+void loop()
+{
+    // Nothing to do, the simulation runs once.
+}
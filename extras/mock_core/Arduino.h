@@ -0,0 +1,84 @@
+/*************** FILE DESCRIPTION ***************/
+
+/**
+ * Filename: Arduino.h
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Purpose:  A minimal mock of the Arduino core that allows building
+ *           the library along with its sketches on a host (PC).
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Notes:    Only provides what the library and its example sketches use.
+ *
+ *           Pin levels are only recorded (see mock_timebase.h), micros()
+ *           and millis() read the host's steady clock, Serial prints
+ *           to stdout.
+ *
+ *           Refer to extras/scripts/host_build.sh for build instructions.
+ */
+
+
+/************ PREPROCESSOR DIRECTIVES ***********/
+
+// Include guards.
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+
+/*--- Includes ---*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+/*--- Misc ---*/
+
+#define LOW    0x0
+#define HIGH   0x1
+#define INPUT  0x0
+#define OUTPUT 0x1
+
+
+/****************** DATA TYPES ******************/
+
+class HardwareSerial {
+    public:
+        void begin(unsigned long baud);
+
+        // The host's stdout is always "connected".
+        explicit operator bool() const
+        {
+            return true;
+        }
+
+        size_t print(const char *str);
+        size_t print(char c);
+        size_t print(int n);
+        size_t print(unsigned int n);
+        size_t print(long n);
+        size_t print(unsigned long n);
+        size_t print(double n, int digits = 2);
+
+        size_t println();
+        template <typename T>
+        size_t println(T val)
+        {
+            return print(val) + println();
+        }
+};
+
+
+/*************** GLOBAL VARIABLES ***************/
+
+extern HardwareSerial Serial;
+
+
+/************** FUNCTION PROTOTYPES *************/
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+
+
+#endif  // Include guards.
@@ -0,0 +1,51 @@
+/*************** FILE DESCRIPTION ***************/
+
+/**
+ * Filename: SPI.h
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Purpose:  A minimal mock of the Arduino SPI library for host (PC) builds.
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Notes:    Transfers go nowhere, received bytes echo the sent ones.
+ *           The last byte sent can be read back with mock_spi_last_byte().
+ *           Transfers may be given a cost in ticks of the mock timebase
+ *           (see mock_timebase.h).
+ */
+
+
+/************ PREPROCESSOR DIRECTIVES ***********/
+
+// Include guards.
+#ifndef SPI_H
+#define SPI_H
+
+
+/*--- Includes ---*/
+
+#include <stdint.h>
+
+
+/****************** DATA TYPES ******************/
+
+class SPIClass {
+    public:
+        void begin();
+        void end();
+        uint8_t transfer(uint8_t data);
+};
+
+
+/*************** GLOBAL VARIABLES ***************/
+
+extern SPIClass SPI;
+
+
+/************** FUNCTION PROTOTYPES *************/
+
+/* Get the last byte sent by SPI.transfer() (mock only).
+ *
+ * Returns: the byte.
+ */
+uint8_t mock_spi_last_byte();
+
+
+#endif  // Include guards.
@@ -0,0 +1,41 @@
+/*************** FILE DESCRIPTION ***************/
+
+/**
+ * Filename: main.cpp
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Purpose:  Entry point that runs an Arduino sketch built against
+ *           the minimal Arduino core mock.
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Notes:    Unlike on an MC, loop() isn't called forever, since a host program
+ *           is expected to terminate. Define MOCK_CORE_LOOP_COUNT to set
+ *           the number of loop() calls after setup().
+ */
+
+
+/************ PREPROCESSOR DIRECTIVES ***********/
+
+/*--- Misc ---*/
+
+#ifndef MOCK_CORE_LOOP_COUNT
+    #define MOCK_CORE_LOOP_COUNT 1
+#endif
+
+
+/************** FUNCTION PROTOTYPES *************/
+
+// Provided by the sketch.
+void setup();
+void loop();
+
+
+/******************* FUNCTIONS ******************/
+
+int main()
+{
+    setup();
+    for (unsigned long i = 0; i < MOCK_CORE_LOOP_COUNT; ++i) {
+        loop();
+    }
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+/*************** FILE DESCRIPTION ***************/
+
+/**
+ * Filename: mock_core.cpp
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Purpose:  Implementation of the minimal Arduino core mock.
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Notes:    Refer to Arduino.h, SPI.h and mock_timebase.h in this directory.
+ */
+
+
+/************ PREPROCESSOR DIRECTIVES ***********/
+
+/*--- Includes ---*/
+
+#include "Arduino.h"
+#include "SPI.h"
+#include "mock_timebase.h"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+
+/*************** GLOBAL VARIABLES ***************/
+
+HardwareSerial Serial;
+SPIClass       SPI;
+
+// Moment the host program started at, the origin of micros() and millis().
+static const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+uint32_t mock_timebase_digital_write_ticks = 0;
+uint32_t mock_timebase_spi_transfer_ticks  = 0;
+
+static uint32_t timebase_ticks = 0;
+
+static uint8_t spi_last_byte = 0;
+
+static uint8_t  pin_levels[MOCK_TIMEBASE_PINS_MAX]     = {0};
+static uint32_t pin_high_ticks[MOCK_TIMEBASE_PINS_MAX] = {0};
+
+
+/******************* FUNCTIONS ******************/
+
+/*--- Pins ---*/
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    if (pin < MOCK_TIMEBASE_PINS_MAX) {
+        pin_levels[pin] = val ? HIGH : LOW;
+    }
+
+    // The new level holds for the time the write takes.
+    mock_timebase_advance(mock_timebase_digital_write_ticks);
+}
+
+
+/*--- Time ---*/
+
+unsigned long micros()
+{
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+
+    // Wraps around at 2^32 the way it does on 32-bit MCs.
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+
+/*--- Serial ---*/
+
+void HardwareSerial::begin(unsigned long) {}
+
+size_t HardwareSerial::print(const char *str)
+{
+    return std::printf("%s", str);
+}
+
+size_t HardwareSerial::print(char c)
+{
+    return std::printf("%c", c);
+}
+
+size_t HardwareSerial::print(int n)
+{
+    return std::printf("%d", n);
+}
+
+size_t HardwareSerial::print(unsigned int n)
+{
+    return std::printf("%u", n);
+}
+
+size_t HardwareSerial::print(long n)
+{
+    return std::printf("%ld", n);
+}
+
+size_t HardwareSerial::print(unsigned long n)
+{
+    return std::printf("%lu", n);
+}
+
+size_t HardwareSerial::print(double n, int digits)
+{
+    return std::printf("%.*f", digits, n);
+}
+
+size_t HardwareSerial::println()
+{
+    return std::printf("\r\n");
+}
+
+
+/*--- SPI ---*/
+
+void SPIClass::begin() {}
+
+void SPIClass::end() {}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    spi_last_byte = data;
+    mock_timebase_advance(mock_timebase_spi_transfer_ticks);
+
+    return data;
+}
+
+uint8_t mock_spi_last_byte()
+{
+    return spi_last_byte;
+}
+
+
+/*--- Mock timebase ---*/
+
+uint32_t mock_timebase_ticks()
+{
+    return timebase_ticks;
+}
+
+void mock_timebase_set(uint32_t ticks)
+{
+    timebase_ticks = ticks;
+}
+
+void mock_timebase_advance(uint32_t ticks)
+{
+    timebase_ticks += ticks;
+
+    for (uint8_t i = 0; i < MOCK_TIMEBASE_PINS_MAX; ++i) {
+        if (pin_levels[i] == HIGH) {
+            pin_high_ticks[i] += ticks;
+        }
+    }
+}
+
+uint8_t mock_timebase_pin_level(uint8_t pin)
+{
+    return pin < MOCK_TIMEBASE_PINS_MAX ? pin_levels[pin] : LOW;
+}
+
+uint32_t mock_timebase_pin_high_ticks(uint8_t pin)
+{
+    return pin < MOCK_TIMEBASE_PINS_MAX ? pin_high_ticks[pin] : 0;
+}
+
+void mock_timebase_pin_high_ticks_reset()
+{
+    for (uint8_t i = 0; i < MOCK_TIMEBASE_PINS_MAX; ++i) {
+        pin_high_ticks[i] = 0;
+    }
+}
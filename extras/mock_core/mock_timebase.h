@@ -0,0 +1,87 @@
+/*************** FILE DESCRIPTION ***************/
+
+/**
+ * Filename: mock_timebase.h
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Purpose:  A mock timebase for host (PC) builds: a simulated tick counter
+ *           that only advances when told to, plus per-pin on-time accounting.
+ * ----------------------------------------------------------------------------|---------------------------------------|
+ * Notes:    Pass mock_timebase_ticks() to Drv7SegQ595Class::set_timebase()
+ *           to make the driver's timing fully deterministic:
+ *           Drv7Seg.set_timebase(mock_timebase_ticks, MOCK_TIMEBASE_TICKS_PER_SEC);
+ *
+ *           digitalWrite() and SPI.transfer() calls may be given a cost
+ *           in ticks to simulate the time an MC spends on them.
+ */
+
+
+/************ PREPROCESSOR DIRECTIVES ***********/
+
+// Include guards.
+#ifndef MOCK_TIMEBASE_H
+#define MOCK_TIMEBASE_H
+
+
+/*--- Includes ---*/
+
+#include <stdint.h>
+
+
+/*--- Misc ---*/
+
+// One tick per microsecond, same as micros().
+#define MOCK_TIMEBASE_TICKS_PER_SEC 1000000u
+
+#define MOCK_TIMEBASE_PINS_MAX 64
+
+
+/*************** GLOBAL VARIABLES ***************/
+
+// Ticks every digitalWrite() call advances the timebase by. Zero by default.
+extern uint32_t mock_timebase_digital_write_ticks;
+
+// Ticks every SPI.transfer() call advances the timebase by. Zero by default.
+extern uint32_t mock_timebase_spi_transfer_ticks;
+
+
+/************** FUNCTION PROTOTYPES *************/
+
+/* Read the simulated tick counter.
+ *
+ * Returns: the current tick count (wraps around at 2^32).
+ */
+uint32_t mock_timebase_ticks();
+
+/* Set the simulated tick counter to a value, e.g. close to 2^32 to check the behavior across a wraparound.
+ * The time isn't accounted for the pins.
+ *
+ * Returns: nothing.
+ */
+void mock_timebase_set(uint32_t ticks);
+
+/* Advance the simulated tick counter, accounting the time for the pins that are at high level.
+ *
+ * Returns: nothing.
+ */
+void mock_timebase_advance(uint32_t ticks);
+
+/* Get the output level last written to a pin.
+ *
+ * Returns: LOW or HIGH.
+ */
+uint8_t mock_timebase_pin_level(uint8_t pin);
+
+/* Get the number of ticks a pin has spent at high level since the last reset.
+ *
+ * Returns: the number of ticks.
+ */
+uint32_t mock_timebase_pin_high_ticks(uint8_t pin);
+
+/* Reset the high level time of all pins.
+ *
+ * Returns: nothing.
+ */
+void mock_timebase_pin_high_ticks_reset();
+
+
+#endif  // Include guards.
@@ -0,0 +1,52 @@
+#!/bin/sh
+
+#************** FILE DESCRIPTION ***************#
+
+# Filename: host_build.sh
+# ----------------------------------------------------------------------------|---------------------------------------|
+# Purpose:  Builds a sketch along with the library against the minimal Arduino
+#           core mock (extras/mock_core) and runs it on the host (PC).
+# ----------------------------------------------------------------------------|---------------------------------------|
+# Notes:    Requires a C++11 compiler (c++ by default, override with CXX).
+#
+#           Usage: extras/scripts/host_build.sh [SKETCH]
+#           SKETCH is a path to an .ino file, defaults to the benchmark sketch,
+#           so the host report can be compared side by side with the reports
+#           printed by the boards.
+#
+#           Extra compiler flags can be passed via CXXFLAGS, e.g.
+#           CXXFLAGS="-O2 -DDRV7SEGQ595_FOOTPRINT_MINIMIZED".
+#
+#           The sketch must only rely on what the mock provides.
+
+
+#******************* SETTINGS ******************#
+
+set -e
+
+# Library root directory (two levels up from this script).
+LIB_DIR="$(cd "$(dirname "$0")/../.." && pwd)"
+
+SKETCH="${1:-$LIB_DIR/examples/Drv7SegQ595_benchmark/Drv7SegQ595_benchmark.ino}"
+
+CXX="${CXX:-c++}"
+CXXFLAGS="${CXXFLAGS:--O2}"
+
+MOCK_DIR="$LIB_DIR/extras/mock_core"
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+
+#******************** MAIN *********************#
+
+# .ino files are plain C++ that implicitly include Arduino.h.
+$CXX -std=gnu++11 -Wall -Wextra $CXXFLAGS \
+     -I"$MOCK_DIR" -I"$LIB_DIR/src" \
+     -include Arduino.h -x c++ "$SKETCH" -x none \
+     "$LIB_DIR/src/Drv7SegQ595.cpp" \
+     "$MOCK_DIR/mock_core.cpp" \
+     "$MOCK_DIR/main.cpp" \
+     -o "$WORK_DIR/sketch"
+
+"$WORK_DIR/sketch"
@@ -0,0 +1,150 @@
+#!/bin/sh
+
+#************** FILE DESCRIPTION ***************#
+
+# Filename: size_report.sh
+# ----------------------------------------------------------------------------|---------------------------------------|
+# Purpose:  Builds a minimal sketch for every data transfer variant, with and
+#           without the footprint-minimized profile, and prints a table
+#           of flash and RAM usage.
+# ----------------------------------------------------------------------------|---------------------------------------|
+# Notes:    Requires arduino-cli with the core for the target board installed.
+#
+#           Usage: extras/scripts/size_report.sh [FQBN]
+#           FQBN defaults to arduino:avr:uno (ATmega328P).
+#
+#           Figures depend on the core and compiler versions, so they're printed
+#           along with the versions and the deltas against an empty sketch,
+#           which are the part attributable to the library.
+
+
+#******************* SETTINGS ******************#
+
+set -e
+
+FQBN="${1:-arduino:avr:uno}"
+
+# Library root directory (two levels up from this script).
+LIB_DIR="$(cd "$(dirname "$0")/../.." && pwd)"
+
+WORK_DIR="$(mktemp -d)"
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+SKETCH_DIR="$WORK_DIR/size_report"
+mkdir -p "$SKETCH_DIR"
+
+LOG_FILE="$WORK_DIR/compile.log"
+
+
+#****************** FUNCTIONS ******************#
+
+# Writes a minimal sketch that configures the driver and runs the output.
+write_sketch()
+{
+    cat > "$SKETCH_DIR/size_report.ino" << 'EOF'
+#ifndef USE_NONE
+    #include <Drv7SegQ595.h>
+#endif
+
+void setup()
+{
+    #ifdef USE_BIT_BANGING
+    Drv7Seg.begin_bb(Drv7SegActiveHigh, 6, 7, 8, 10, 11, 12, 9);
+    #endif
+
+    #ifdef USE_SPI_DEFAULT_PINS
+    Drv7Seg.begin_spi(Drv7SegActiveHigh, 7, 10, 11, 12, 9);
+    #endif
+
+    #ifdef USE_USART_SPI
+    Drv7Seg.begin_usart_spi(Drv7SegActiveHigh, 0, 7, 4, 10, 11, 12, 9);
+    #endif
+
+    #ifndef USE_NONE
+    Drv7Seg.set_glyph_to_pos(0x06, Drv7SegPos1);
+    #endif
+}
+
+void loop()
+{
+    #ifndef USE_NONE
+    Drv7Seg.output_all();
+    #endif
+}
+EOF
+}
+
+# Builds the sketch with the given preprocessor flags and prints "flash ram".
+# Exits the script with the compiler log if the build fails or its size figures can't be parsed.
+build()
+{
+    if ! arduino-cli compile --fqbn "$FQBN" \
+                             --library "$LIB_DIR" \
+                             --build-property "compiler.cpp.extra_flags=$1" \
+                             "$SKETCH_DIR" > "$LOG_FILE" 2>&1; then
+        fail "build with flags \"$1\" failed"
+    fi
+
+    SIZES="$(awk '/Sketch uses/      { flash = $3 }
+                  /Global variables/ { ram   = $4 }
+                  END                { if (flash != "" && ram != "") print flash, ram }' "$LOG_FILE")"
+    if [ -z "$SIZES" ]; then
+        fail "no size figures in the output of the build with flags \"$1\""
+    fi
+}
+
+# Prints the version of the core the FQBN belongs to and the C++ compiler it uses ("unknown" if not found).
+versions()
+{
+    CORE="$(echo "$FQBN" | cut -d : -f 1,2)"
+    CORE_VERSION="$(arduino-cli core list | awk -v core="$CORE" '$1 == core { print $2 }')"
+
+    # The compiler path and command are taken from the build properties of the board.
+    PROPERTIES="$(arduino-cli compile --fqbn "$FQBN" --show-properties "$SKETCH_DIR" 2> /dev/null || true)"
+    COMPILER_PATH="$(echo "$PROPERTIES" | sed -n 's/^compiler\.path=//p')"
+    COMPILER_CMD="$(echo "$PROPERTIES" | sed -n 's/^compiler\.cpp\.cmd=//p')"
+    COMPILER_VERSION="$("$COMPILER_PATH$COMPILER_CMD" --version 2> /dev/null | head -n 1 || true)"
+
+    echo "Core: $CORE ${CORE_VERSION:-unknown}, compiler: ${COMPILER_VERSION:-unknown}."
+}
+
+# Prints an error message along with the compiler log to stderr and exits.
+fail()
+{
+    echo "size_report.sh: $1, compiler log:" >&2
+    cat "$LOG_FILE" >&2
+    exit 1
+}
+
+# Prints a single table row.
+row()
+{
+    build "$3"
+    set -- "$1" "$2" $SIZES
+    printf '| %-12s | %-10s | %6s | %6s | %+6d | %+6d |\n' \
+           "$1" "$2" "$3" "$4" "$(($3 - BASE_FLASH))" "$(($4 - BASE_RAM))"
+}
+
+
+#******************** MAIN *********************#
+
+write_sketch
+
+build "-DUSE_NONE"
+set -- $SIZES
+BASE_FLASH="$1"
+BASE_RAM="$2"
+
+echo "Drv7SegQ595 size report, FQBN: $FQBN"
+versions
+echo "Empty sketch: $BASE_FLASH bytes of flash, $BASE_RAM bytes of RAM."
+echo
+echo "| Variant      | Profile    |  Flash |    RAM | dFlash |   dRAM |"
+echo "|--------------|------------|--------|--------|--------|--------|"
+
+row "bit-banging" "default"   "-DUSE_BIT_BANGING"
+row "bit-banging" "minimized" "-DUSE_BIT_BANGING -DDRV7SEGQ595_FOOTPRINT_MINIMIZED"
+row "SPI"         "default"   "-DUSE_SPI_DEFAULT_PINS"
+row "SPI"         "minimized" "-DUSE_SPI_DEFAULT_PINS -DDRV7SEGQ595_FOOTPRINT_MINIMIZED -DDRV7SEGQ595_FOOTPRINT_KEEP_SPI"
+row "USART SPI"   "default"   "-DUSE_USART_SPI"
+row "USART SPI"   "minimized" "-DUSE_USART_SPI -DDRV7SEGQ595_FOOTPRINT_MINIMIZED -DDRV7SEGQ595_FOOTPRINT_KEEP_USART_SPI"
@@ -27,6 +27,27 @@
     #include <SPI.h>
 #endif
 
+// Native timebase headers.
+#if defined(DRV7SEGQ595_TIMEBASE_ESP32_CYCLE_COUNT)
+    #include <esp_idf_version.h>
+    #include <esp_cpu.h>
+#elif defined(DRV7SEGQ595_TIMEBASE_RP2040_TIMER)
+    #include <hardware/timer.h>
+#endif
+
+
+/*************** EXTERNAL VARIABLES *************/
+
+#ifdef DRV7SEGQ595_TIMEBASE_AVR_TIMER0
+// Timer0 overflow counter maintained by the Arduino AVR core (see wiring.c).
+extern "C" volatile unsigned long timer0_overflow_count;
+#endif
+
+#if defined(DRV7SEGQ595_TIMEBASE_CORTEX_M_DWT) && !defined(F_CPU)
+// CMSIS core clock frequency.
+extern "C" uint32_t SystemCoreClock;
+#endif
+
 
 /*************** GLOBAL VARIABLES ***************/
 
@@ -42,15 +63,16 @@ Drv7SegQ595Class::Drv7SegQ595Class() {}
 
 /*--- Public methods ---*/
 
-int32_t Drv7SegQ595Class::begin_bb(PosSwitchType pos_switch_type,
-                                   uint32_t data_pin,
-                                   uint32_t latch_pin,
-                                   uint32_t clock_pin,
-                                   int32_t pos_1_pin,
-                                   int32_t pos_2_pin,
-                                   int32_t pos_3_pin,
-                                   int32_t pos_4_pin
-                                  )
+#ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+Drv7SegQ595Class::Status Drv7SegQ595Class::begin_bb(PosSwitchType pos_switch_type,
+                                                    Pin data_pin,
+                                                    Pin latch_pin,
+                                                    Pin clock_pin,
+                                                    PosPin pos_1_pin,
+                                                    PosPin pos_2_pin,
+                                                    PosPin pos_3_pin,
+                                                    PosPin pos_4_pin
+                                                   )
 {
     _status = begin_helper(DRV7SEGQ595_VARIANT_BIT_BANGING,
                            pos_switch_type,
@@ -72,15 +94,16 @@ int32_t Drv7SegQ595Class::begin_bb(PosSwitchType pos_switch_type,
 
     return _status;
 }
+#endif
 
 #ifdef DRV7SEGQ595_SPI_PROVIDED
-int32_t Drv7SegQ595Class::begin_spi(PosSwitchType pos_switch_type,
-                                    uint32_t latch_pin,
-                                    int32_t pos_1_pin,
-                                    int32_t pos_2_pin,
-                                    int32_t pos_3_pin,
-                                    int32_t pos_4_pin
-                                   )
+Drv7SegQ595Class::Status Drv7SegQ595Class::begin_spi(PosSwitchType pos_switch_type,
+                                                     Pin latch_pin,
+                                                     PosPin pos_1_pin,
+                                                     PosPin pos_2_pin,
+                                                     PosPin pos_3_pin,
+                                                     PosPin pos_4_pin
+                                                    )
 {
     _status = begin_helper(DRV7SEGQ595_VARIANT_SPI,
                            pos_switch_type,
@@ -102,15 +125,15 @@ int32_t Drv7SegQ595Class::begin_spi(PosSwitchType pos_switch_type,
 #endif
 
 #ifdef DRV7SEGQ595_SPI_PROVIDED_CUSTOM_PINS
-int32_t Drv7SegQ595Class::begin_spi_custom_pins(PosSwitchType pos_switch_type,
-                                                uint32_t mosi_pin,
-                                                uint32_t latch_pin,
-                                                uint32_t sck_pin,
-                                                int32_t pos_1_pin,
-                                                int32_t pos_2_pin,
-                                                int32_t pos_3_pin,
-                                                int32_t pos_4_pin
-                                               )
+Drv7SegQ595Class::Status Drv7SegQ595Class::begin_spi_custom_pins(PosSwitchType pos_switch_type,
+                                                                 Pin mosi_pin,
+                                                                 Pin latch_pin,
+                                                                 Pin sck_pin,
+                                                                 PosPin pos_1_pin,
+                                                                 PosPin pos_2_pin,
+                                                                 PosPin pos_3_pin,
+                                                                 PosPin pos_4_pin
+                                                                )
 {
     _status = begin_helper(DRV7SEGQ595_VARIANT_SPI,
                            pos_switch_type,
@@ -140,12 +163,110 @@ int32_t Drv7SegQ595Class::begin_spi_custom_pins(PosSwitchType pos_switch_type,
 }
 #endif
 
-int32_t Drv7SegQ595Class::get_status()
+#ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+Drv7SegQ595Class::Status Drv7SegQ595Class::begin_usart_spi(PosSwitchType pos_switch_type,
+                                                           uint8_t usart_num,
+                                                           Pin latch_pin,
+                                                           Pin xck_pin,
+                                                           PosPin pos_1_pin,
+                                                           PosPin pos_2_pin,
+                                                           PosPin pos_3_pin,
+                                                           PosPin pos_4_pin
+                                                          )
+{
+    /*--- USART instance selection ---*/
+
+    volatile uint8_t  *ucsra;
+    volatile uint8_t  *ucsrb;
+    volatile uint8_t  *ucsrc;
+    volatile uint16_t *ubrr;
+    volatile uint8_t  *udr;
+
+    switch (usart_num) {
+        #ifdef UCSR0A
+        case 0:
+            ucsra = &UCSR0A;
+            ucsrb = &UCSR0B;
+            ucsrc = &UCSR0C;
+            ubrr  = &UBRR0;
+            udr   = &UDR0;
+            break;
+        #endif
+
+        #ifdef UCSR1A
+        case 1:
+            ucsra = &UCSR1A;
+            ucsrb = &UCSR1B;
+            ucsrc = &UCSR1C;
+            ubrr  = &UBRR1;
+            udr   = &UDR1;
+            break;
+        #endif
+
+        #ifdef UCSR2A
+        case 2:
+            ucsra = &UCSR2A;
+            ucsrb = &UCSR2B;
+            ucsrc = &UCSR2C;
+            ubrr  = &UBRR2;
+            udr   = &UDR2;
+            break;
+        #endif
+
+        #ifdef UCSR3A
+        case 3:
+            ucsra = &UCSR3A;
+            ucsrb = &UCSR3B;
+            ucsrc = &UCSR3C;
+            ubrr  = &UBRR3;
+            udr   = &UDR3;
+            break;
+        #endif
+
+        default:
+            _status = DRV7SEGQ595_STATUS_ERR_INVALID_USART;
+            return _status;
+    }
+
+
+    /*--- Common configuration ---*/
+
+    _status = begin_helper(DRV7SEGQ595_VARIANT_USART_SPI,
+                           pos_switch_type,
+                           latch_pin,
+                           pos_1_pin,
+                           pos_2_pin,
+                           pos_3_pin,
+                           pos_4_pin
+                          );
+
+    if (_status < 0) {
+        return _status;
+    }
+
+
+    /*--- USART initialization (as per the Master SPI mode section of the AVR datasheets) ---*/
+
+    _usart_ucsra       = ucsra;
+    _usart_udr         = udr;
+    _usart_spi_pending = false;
+
+    *ubrr = 0;
+    pinMode(xck_pin, OUTPUT);  // Setting the XCKn pin as output enables the master mode.
+    *ucsrc = DRV7SEGQ595_USART_UCSRC_MSPIM_MODE_0_MSB_FIRST;
+    *ucsrb = 1u << DRV7SEGQ595_USART_UCSRB_TXEN;
+    *ubrr  = DRV7SEGQ595_USART_SPI_UBRR;  // Must be set after the transmitter is enabled.
+
+    return _status;
+}
+#endif
+
+Drv7SegQ595Class::Status Drv7SegQ595Class::get_status()
 {
     return _status;
 }
 
-int32_t Drv7SegQ595Class::set_glyph_to_pos(uint8_t seg_byte, Pos pos)
+Drv7SegQ595Class::Status Drv7SegQ595Class::set_glyph_to_pos(uint8_t seg_byte, Pos pos)
 {
     /*--- Configuration status check ---*/
 
@@ -156,9 +277,11 @@ int32_t Drv7SegQ595Class::set_glyph_to_pos(uint8_t seg_byte, Pos pos)
 
     /*--- Protection from unexpected casts ---*/
 
+    #ifndef DRV7SEGQ595_FOOTPRINT_MINIMIZED
     if (pos < Drv7SegPos1 || pos > Drv7SegPos4) {
         return DRV7SEGQ595_SET_GLYPH_ERR_INVALID_POS;
     }
+    #endif
 
 
     /*--- Assign a glyph to a position ---*/
@@ -166,15 +289,79 @@ int32_t Drv7SegQ595Class::set_glyph_to_pos(uint8_t seg_byte, Pos pos)
     size_t pos_as_index = static_cast<size_t>(pos) - 1;
     if (_pos_pins[pos_as_index] <= DRV7SEGQ595_POS_PIN_INITIAL) {
         return DRV7SEGQ595_SET_GLYPH_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS;
-    } else {
+    } else if (_pos_glyphs[pos_as_index] != seg_byte) {
         _pos_glyphs[pos_as_index] = seg_byte;
-        return DRV7SEGQ595_SET_GLYPH_OK;
+        // The rotation only depends on the glyphs if blank positions are skipped.
+        if (_blank_pos_skipping) {
+            update_rotation();
+        }
+    }
+
+    return DRV7SEGQ595_SET_GLYPH_OK;
+}
+
+Drv7SegQ595Class::Status Drv7SegQ595Class::set_blink_to_pos(uint8_t blink_mask, Pos pos, bool blink_phase_inverted)
+{
+    Status pos_check = attr_pos_check(pos);
+    if (pos_check < 0) {
+        return pos_check;
+    }
+
+    size_t pos_as_index = static_cast<size_t>(pos) - 1;
+    _pos_blink_masks[pos_as_index]           = blink_mask;
+    _pos_blink_phases_inverted[pos_as_index] = blink_phase_inverted;
+
+    return DRV7SEGQ595_SET_ATTR_OK;
+}
+
+Drv7SegQ595Class::Status Drv7SegQ595Class::set_forced_segments_to_pos(uint8_t forced_mask, Pos pos)
+{
+    Status pos_check = attr_pos_check(pos);
+    if (pos_check < 0) {
+        return pos_check;
+    }
+
+    _pos_forced_masks[static_cast<size_t>(pos) - 1] = forced_mask;
+    if (_blank_pos_skipping) {
+        update_rotation();
     }
+
+    return DRV7SEGQ595_SET_ATTR_OK;
 }
 
-int32_t Drv7SegQ595Class::output(uint8_t seg_byte,
-                                 Pos pos
-                                )
+Drv7SegQ595Class::Status Drv7SegQ595Class::set_inverted_segments_to_pos(uint8_t inverted_mask, Pos pos)
+{
+    Status pos_check = attr_pos_check(pos);
+    if (pos_check < 0) {
+        return pos_check;
+    }
+
+    _pos_inverted_masks[static_cast<size_t>(pos) - 1] = inverted_mask;
+    if (_blank_pos_skipping) {
+        update_rotation();
+    }
+
+    return DRV7SEGQ595_SET_ATTR_OK;
+}
+
+Drv7SegQ595Class::Status Drv7SegQ595Class::set_blank_to_pos(bool blank, Pos pos)
+{
+    Status pos_check = attr_pos_check(pos);
+    if (pos_check < 0) {
+        return pos_check;
+    }
+
+    _pos_blank[static_cast<size_t>(pos) - 1] = blank;
+    if (_blank_pos_skipping) {
+        update_rotation();
+    }
+
+    return DRV7SEGQ595_SET_ATTR_OK;
+}
+
+Drv7SegQ595Class::Status Drv7SegQ595Class::output(uint8_t seg_byte,
+                                                  Pos pos
+                                                 )
 {
     /*--- Configuration status check ---*/
 
@@ -185,9 +372,11 @@ int32_t Drv7SegQ595Class::output(uint8_t seg_byte,
 
     /*--- Protection from unexpected casts ---*/
 
+    #ifndef DRV7SEGQ595_FOOTPRINT_MINIMIZED
     if (pos < Drv7SegPos1 || pos > Drv7SegPos4) {
         return DRV7SEGQ595_OUTPUT_ERR_INVALID_POS;
     }
+    #endif
 
 
     /*--- Anti-ghosting retention ---*/
@@ -211,7 +400,7 @@ int32_t Drv7SegQ595Class::output(uint8_t seg_byte,
 
     /*--- Account for a character position switch type ---*/
 
-    int32_t active = HIGH;
+    uint8_t active = HIGH;
     if (_pos_switch_type == Drv7SegActiveLow) {
         active = !active;
     }
@@ -225,6 +414,21 @@ int32_t Drv7SegQ595Class::output(uint8_t seg_byte,
     }
 
 
+    /*--- Apply the position attributes ---*/
+
+    seg_byte = apply_pos_attrs(seg_byte, pos_as_index);
+
+
+    /*--- Duty measurement ---*/
+
+    // The retained position is about to be turned off, account for the time it's been on.
+    uint32_t switch_off_ticks = timebase_ticks();
+    size_t   retained_pos_as_index = static_cast<size_t>(_anti_ghosting_retained_pos) - 1;
+    if (_duty_pos_on) {
+        _duty_pos_on_ticks[retained_pos_as_index] += switch_off_ticks - _anti_ghosting_timer_previous_ticks;
+    }
+
+
     /*--- Switching the position-control pins ---*/
 
     for (size_t i = 0; i < DRV7SEGQ595_POS_MAX; ++i) {
@@ -236,32 +440,17 @@ int32_t Drv7SegQ595Class::output(uint8_t seg_byte,
 
     /*--- Shift data ---*/
 
-    switch (_variant) {
-        case DRV7SEGQ595_VARIANT_BIT_BANGING:
-            digitalWrite(_latch_pin, LOW);
-            shift_out(DRV7SEGQ595_ALL_BITS_CLEARED_MASK);
-            digitalWrite(_latch_pin, HIGH);
-
-            digitalWrite(_latch_pin, LOW);
-            shift_out(seg_byte);
-            digitalWrite(_latch_pin, HIGH);
-            break;
-
-        #ifdef DRV7SEGQ595_SPI_PROVIDED
-        case DRV7SEGQ595_VARIANT_SPI:
-            digitalWrite(_latch_pin, LOW);
-            SPI.transfer(DRV7SEGQ595_ALL_BITS_CLEARED_MASK);
-            digitalWrite(_latch_pin, HIGH);
-
-            digitalWrite(_latch_pin, LOW);
-            SPI.transfer(seg_byte);
-            digitalWrite(_latch_pin, HIGH);
-            break;
-        #endif
+    if (_pipelined_preloaded && _pipelined_preloaded_pos == pos && _pipelined_preloaded_seg_byte == seg_byte) {
+        // The seg_byte was shifted during the previous retention, only latching is left.
+        latch();
+    } else {
+        transfer(DRV7SEGQ595_ALL_BITS_CLEARED_MASK);
+        latch();
 
-        default:
-            break;  // Do nothing and hail MISRA.
+        transfer(seg_byte);
+        latch();
     }
+    _pipelined_preloaded = false;
 
 
     /*--- Switching the position-control pins, continued ---*/
@@ -271,7 +460,35 @@ int32_t Drv7SegQ595Class::output(uint8_t seg_byte,
 
     // Update the values related to the anti-ghosting logic.
     _anti_ghosting_retained_pos = pos;
-    _anti_ghosting_timer_previous_micros = micros();
+    _anti_ghosting_timer_previous_ticks = timebase_ticks();
+
+    // A frame is over once the rotation wraps around (or on the first slot, which starts the measurement).
+    if (_duty_pos_on == false || pos_as_index <= retained_pos_as_index) {
+        frame_complete(_anti_ghosting_timer_previous_ticks);
+    }
+    _duty_pos_on = true;
+
+    // Time spent on shifting the data and switching the pins, while all positions were turned off.
+    _slot_overhead_ticks_sum += _anti_ghosting_timer_previous_ticks - switch_off_ticks;
+    ++_frame_slot_count;
+
+    // Blink phase gets updated once per slot and is applied starting with the next one.
+    blink_timer(_anti_ghosting_timer_previous_ticks);
+
+
+    /*--- Preload the next position's seg_byte ---*/
+
+    /* The shift register and the storage (output) register of the IC are separate,
+     * so shifting doesn't affect the glyph being output until the next latching.
+     */
+    if (_pipelined_shifting) {
+        size_t next_pos_as_index = static_cast<size_t>(anti_ghosting_next_pos_to_output()) - 1;
+
+        _pipelined_preloaded_pos      = static_cast<Pos>(next_pos_as_index + 1);
+        _pipelined_preloaded_seg_byte = apply_pos_attrs(_pos_glyphs[next_pos_as_index], next_pos_as_index);
+        transfer(_pipelined_preloaded_seg_byte);
+        _pipelined_preloaded = true;
+    }
 
     return DRV7SEGQ595_OUTPUT_NEXT;
 }
@@ -288,7 +505,10 @@ void Drv7SegQ595Class::output_all()
     /*--- Output ---*/
 
     for (size_t i = 0; i < DRV7SEGQ595_POS_MAX; ++i) {
-         output(_pos_glyphs[i], static_cast<Pos>(i + 1));
+        // Positions out of the rotation are either unused or skipped as blank.
+        if (_pos_in_rotation[i]) {
+            output(_pos_glyphs[i], static_cast<Pos>(i + 1));
+        }
     }
 }
 
@@ -304,20 +524,147 @@ void Drv7SegQ595Class::set_anti_ghosting_retention_duration(uint32_t new_val)
     /*--- Retention duration control ---*/
 
     _anti_ghosting_retention_duration = new_val;
+    update_effective_retention();
+}
+
+void Drv7SegQ595Class::set_blink_period(uint32_t new_val)
+{
+    _blink_half_period       = new_val * DRV7SEGQ595_MICROS_IN_MILLI / 2;
+    _blink_half_period_ticks = micros_to_ticks(_blink_half_period);
+}
+
+void Drv7SegQ595Class::set_blank_glyph(uint8_t seg_byte)
+{
+    _blank_glyph = seg_byte;
+    update_rotation();
+}
+
+void Drv7SegQ595Class::set_pipelined_shifting(bool enabled)
+{
+    _pipelined_shifting  = enabled;
+    _pipelined_preloaded = false;
+}
+
+void Drv7SegQ595Class::discard_pipelined_preload()
+{
+    _pipelined_preloaded = false;
+}
+
+void Drv7SegQ595Class::set_timebase(uint32_t (*ticks_func)(), uint32_t ticks_per_sec)
+{
+    _timebase_ticks_func = ticks_func;
+
+    if (_timebase_ticks_func == nullptr) {
+        timebase_init();
+    } else {
+        _timebase_ticks_per_ms = ticks_per_sec / DRV7SEGQ595_MICROS_IN_MILLI;
+    }
+
+    // Convert the durations to the new ticks and restart the timers and the measurements.
+    _slot_overhead_ticks     = 0;
+    _blink_half_period_ticks = micros_to_ticks(_blink_half_period);
+    update_effective_retention();
+    _anti_ghosting_timer_previous_ticks = timebase_ticks();
+    _blink_timer_previous_ticks         = _anti_ghosting_timer_previous_ticks;
+    _duty_pos_on                        = false;
+    _duty_last_frame_ticks              = 0;
+}
+
+void Drv7SegQ595Class::set_blank_pos_skipping(bool enabled)
+{
+    _blank_pos_skipping = enabled;
+    update_rotation();
+}
+
+int16_t Drv7SegQ595Class::get_slot_share_of_pos(Pos pos)
+{
+    /*--- Configuration status check ---*/
+
+    if (_status < 0) {
+        return _status;
+    }
+
+
+    /*--- Protection from unexpected casts ---*/
+
+    #ifndef DRV7SEGQ595_FOOTPRINT_MINIMIZED
+    if (pos < Drv7SegPos1 || pos > Drv7SegPos4) {
+        return DRV7SEGQ595_GET_SLOT_SHARE_ERR_INVALID_POS;
+    }
+    #endif
+
+
+    /*--- Slot share calculation ---*/
+
+    size_t pos_as_index = static_cast<size_t>(pos) - 1;
+    if (_pos_pins[pos_as_index] <= DRV7SEGQ595_POS_PIN_INITIAL) {
+        return DRV7SEGQ595_GET_SLOT_SHARE_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS;
+    }
+
+    if (_pos_in_rotation[pos_as_index] == false) {
+        return 0;
+    }
+
+    // Every position in the rotation gets an equal slot of the frame period.
+    return DRV7SEGQ595_SLOT_SHARE_FULL / _pos_in_rotation_count;
+}
+
+int16_t Drv7SegQ595Class::get_duty_of_pos(Pos pos)
+{
+    /*--- Configuration status check ---*/
+
+    if (_status < 0) {
+        return _status;
+    }
+
+
+    /*--- Protection from unexpected casts ---*/
+
+    #ifndef DRV7SEGQ595_FOOTPRINT_MINIMIZED
+    if (pos < Drv7SegPos1 || pos > Drv7SegPos4) {
+        return DRV7SEGQ595_GET_DUTY_ERR_INVALID_POS;
+    }
+    #endif
+
+
+    /*--- Duty calculation ---*/
+
+    size_t pos_as_index = static_cast<size_t>(pos) - 1;
+    if (_pos_pins[pos_as_index] <= DRV7SEGQ595_POS_PIN_INITIAL) {
+        return DRV7SEGQ595_GET_DUTY_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS;
+    }
+
+    // No frame has been completed yet.
+    if (_duty_last_frame_ticks == 0) {
+        return 0;
+    }
+
+    uint32_t on_ticks    = _duty_last_frame_pos_on_ticks[pos_as_index];
+    uint32_t frame_ticks = _duty_last_frame_ticks;
+
+    // Scale both down if necessary to avoid both overflow and 64-bit arithmetic.
+    while (frame_ticks > UINT32_MAX / DRV7SEGQ595_DUTY_FULL) {
+        frame_ticks >>= 1;
+        on_ticks    >>= 1;
+    }
+
+    return on_ticks * DRV7SEGQ595_DUTY_FULL / frame_ticks;
 }
 
 
 /*--- Private methods ---*/
 
-int32_t Drv7SegQ595Class::begin_helper(int32_t variant,
-                                       PosSwitchType pos_switch_type,
-                                       uint32_t latch_pin,
-                                       int32_t pos_1_pin,
-                                       int32_t pos_2_pin,
-                                       int32_t pos_3_pin,
-                                       int32_t pos_4_pin
-                                      )
+Drv7SegQ595Class::Status Drv7SegQ595Class::begin_helper(int8_t variant,
+                                                        PosSwitchType pos_switch_type,
+                                                        Pin latch_pin,
+                                                        PosPin pos_1_pin,
+                                                        PosPin pos_2_pin,
+                                                        PosPin pos_3_pin,
+                                                        PosPin pos_4_pin
+                                                       )
 {
+    // Redundant safety measures below are stripped by the footprint-minimized profile.
+    #ifndef DRV7SEGQ595_FOOTPRINT_MINIMIZED
     /* Highly unlikely to occur without messing with the code,
      * but preserved as a redundant safety measure.
      */
@@ -329,9 +676,10 @@ int32_t Drv7SegQ595Class::begin_helper(int32_t variant,
     if (pos_switch_type != Drv7SegActiveLow && pos_switch_type != Drv7SegActiveHigh) {
         return DRV7SEGQ595_STATUS_ERR_INVALID_POS_SWITCH_TYPE;
     }
+    #endif
 
     // Position-control pins validity check.
-    int32_t pos_pins[DRV7SEGQ595_POS_MAX] = {pos_1_pin, pos_2_pin, pos_3_pin, pos_4_pin};
+    PosPin pos_pins[DRV7SEGQ595_POS_MAX] = {pos_1_pin, pos_2_pin, pos_3_pin, pos_4_pin};
     for (uint32_t i = 0; i < DRV7SEGQ595_POS_MAX; ++i) {
 
         // First position-control pin (array index zero) must be >= 0.
@@ -349,6 +697,7 @@ int32_t Drv7SegQ595Class::begin_helper(int32_t variant,
         }
 
         // Position-control pins duplication check.
+        #ifndef DRV7SEGQ595_FOOTPRINT_MINIMIZED
         for (uint32_t j = i + 1; j < DRV7SEGQ595_POS_MAX; ++j) {
             if (pos_pins[i] != DRV7SEGQ595_POS_PIN_INITIAL &&
                 pos_pins[j] != DRV7SEGQ595_POS_PIN_INITIAL &&
@@ -356,6 +705,7 @@ int32_t Drv7SegQ595Class::begin_helper(int32_t variant,
                 return DRV7SEGQ595_STATUS_ERR_POS_PIN_DUPLICATION;
             }
         }
+        #endif
     }
 
     _variant         = variant;
@@ -364,6 +714,12 @@ int32_t Drv7SegQ595Class::begin_helper(int32_t variant,
     _latch_pin = latch_pin;
     pinMode(_latch_pin, OUTPUT);
 
+    if (_timebase_ticks_func == nullptr) {
+        timebase_init();
+        _blink_half_period_ticks = micros_to_ticks(_blink_half_period);
+        update_effective_retention();
+    }
+
     _pos_pins[0] = pos_1_pin;
     _pos_pins[1] = pos_2_pin;
     _pos_pins[2] = pos_3_pin;
@@ -373,6 +729,7 @@ int32_t Drv7SegQ595Class::begin_helper(int32_t variant,
             pinMode(_pos_pins[i], OUTPUT);
         }
     }
+    update_rotation();
 
     /* Reset the variables related to the anti-ghosting logic
      * (useful if the driver gets reconfigured mid-use).
@@ -382,23 +739,337 @@ int32_t Drv7SegQ595Class::begin_helper(int32_t variant,
                                                           * for output. Not strictly necessary, but preserved
                                                           * as a redundant safety measure.
                                                           */
-    _anti_ghosting_timer_previous_micros = 0;            /* Could call micros() instead, either is fine.
+    _anti_ghosting_timer_previous_ticks = 0;             /* Could read the timebase instead, either is fine.
                                                           * Not strictly necessary, but preserved
                                                           * as a redundant safety measure.
                                                           */
+    _pipelined_preloaded                = false;
+
+    // Restart the duty and slot overhead measurements.
+    _duty_pos_on                               = false;
+    _duty_last_frame_ticks                     = 0;
+    _slot_overhead_ticks                       = 0;
+    _anti_ghosting_overhead_compensation_ticks = 0;
 
     return DRV7SEGQ595_STATUS_OK;
 }
 
+#ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
 void Drv7SegQ595Class::shift_out(uint8_t byte_to_shift)
 {
     digitalWrite(_clock_pin, LOW);
-    for (uint32_t i = 0; i < DRV7SEGQ595_BITS_IN_BYTE; i++) {
+    for (uint8_t i = 0; i < DRV7SEGQ595_BITS_IN_BYTE; i++) {
         digitalWrite(_data_pin, (byte_to_shift << i) & DRV7SEGQ595_ONLY_MSB_SET_MASK);
         digitalWrite(_clock_pin, HIGH);
         digitalWrite(_clock_pin, LOW);
     }
 }
+#endif
+
+#ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+void Drv7SegQ595Class::usart_spi_transfer(uint8_t byte_to_shift)
+{
+    /* Wait only until the transmit buffer is free, so the byte gets queued while the previous one
+     * may still be shifting (the transmitter is double-buffered).
+     */
+    while (!(*_usart_ucsra & (1u << DRV7SEGQ595_USART_UCSRA_UDRE))) {
+        // Wait until the transmit buffer is empty.
+    }
+
+    /* The transmit complete flag only gets set once the buffer is empty, so after the byte is queued
+     * it may only be left over from the previous byte, and clearing it right away makes it track
+     * the byte queued. Interrupts are disabled so that the byte cannot be shifted out (and set
+     * the flag) between the two writes.
+     */
+    uint8_t sreg = SREG;
+    cli();
+    *_usart_udr   = byte_to_shift;
+    // Writing one clears the flag. Other writable bits must be written to zero in the Master SPI mode.
+    *_usart_ucsra = 1u << DRV7SEGQ595_USART_UCSRA_TXC;
+    SREG = sreg;
+
+    _usart_spi_pending = true;
+}
+
+void Drv7SegQ595Class::usart_spi_wait()
+{
+    if (_usart_spi_pending == false) {
+        return;
+    }
+
+    while (!(*_usart_ucsra & (1u << DRV7SEGQ595_USART_UCSRA_TXC))) {
+        // Wait until the byte is completely shifted out.
+    }
+
+    _usart_spi_pending = false;
+}
+#endif
+
+void Drv7SegQ595Class::transfer(uint8_t byte_to_shift)
+{
+    switch (_variant) {
+        #ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+        case DRV7SEGQ595_VARIANT_BIT_BANGING:
+            shift_out(byte_to_shift);
+            break;
+        #endif
+
+        #ifdef DRV7SEGQ595_SPI_PROVIDED
+        case DRV7SEGQ595_VARIANT_SPI:
+            SPI.transfer(byte_to_shift);
+            break;
+        #endif
+
+        #ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+        case DRV7SEGQ595_VARIANT_USART_SPI:
+            usart_spi_transfer(byte_to_shift);
+            break;
+        #endif
+
+        default:
+            break;  // Do nothing and hail MISRA.
+    }
+}
+
+void Drv7SegQ595Class::latch()
+{
+    #ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+    // The only variant that may still be shifting at this point.
+    if (_variant == DRV7SEGQ595_VARIANT_USART_SPI) {
+        usart_spi_wait();
+    }
+    #endif
+
+    digitalWrite(_latch_pin, LOW);
+    digitalWrite(_latch_pin, HIGH);
+}
+
+Drv7SegQ595Class::Status Drv7SegQ595Class::attr_pos_check(Pos pos)
+{
+    /*--- Configuration status check ---*/
+
+    if (_status < 0) {
+        return _status;
+    }
+
+
+    /*--- Protection from unexpected casts ---*/
+
+    #ifndef DRV7SEGQ595_FOOTPRINT_MINIMIZED
+    if (pos < Drv7SegPos1 || pos > Drv7SegPos4) {
+        return DRV7SEGQ595_SET_ATTR_ERR_INVALID_POS;
+    }
+    #endif
+
+
+    /*--- Position-control pin check ---*/
+
+    if (_pos_pins[static_cast<size_t>(pos) - 1] <= DRV7SEGQ595_POS_PIN_INITIAL) {
+        return DRV7SEGQ595_SET_ATTR_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS;
+    }
+
+    return DRV7SEGQ595_SET_ATTR_OK;
+}
+
+uint8_t Drv7SegQ595Class::apply_pos_attrs(uint8_t seg_byte, size_t pos_as_index)
+{
+    if (_pos_blank[pos_as_index]) {
+        return _blank_glyph;
+    }
+
+    seg_byte = apply_static_pos_attrs(seg_byte, pos_as_index);
+
+    if (_blink_phase_off != _pos_blink_phases_inverted[pos_as_index]) {
+        uint8_t blink_mask = _pos_blink_masks[pos_as_index];
+        seg_byte = (seg_byte & ~blink_mask) | (_blank_glyph & blink_mask);
+    }
+
+    return seg_byte;
+}
+
+uint8_t Drv7SegQ595Class::apply_static_pos_attrs(uint8_t seg_byte, size_t pos_as_index)
+{
+    // Bits that turn the segments ON are the ones that differ from the blank glyph.
+    uint8_t forced_mask = _pos_forced_masks[pos_as_index];
+    seg_byte = (seg_byte & ~forced_mask) | (~_blank_glyph & forced_mask);
+
+    return seg_byte ^ _pos_inverted_masks[pos_as_index];
+}
+
+void Drv7SegQ595Class::update_rotation()
+{
+    uint8_t configured_count = 0;
+    uint8_t lit_count        = 0;
+    bool    pos_lit[DRV7SEGQ595_POS_MAX];
+
+    for (size_t i = 0; i < DRV7SEGQ595_POS_MAX; ++i) {
+        pos_lit[i] = false;
+        if (_pos_pins[i] <= DRV7SEGQ595_POS_PIN_INITIAL) {
+            continue;
+        }
+
+        ++configured_count;
+        if (_blank_pos_skipping &&
+            _pos_blank[i] == false && apply_static_pos_attrs(_pos_glyphs[i], i) != _blank_glyph) {
+            pos_lit[i] = true;
+            ++lit_count;
+        }
+    }
+
+    // If nothing is lit, there's nothing to redistribute, so all configured positions stay in the rotation.
+    bool skip = _blank_pos_skipping && lit_count > 0;
+
+    for (size_t i = 0; i < DRV7SEGQ595_POS_MAX; ++i) {
+        _pos_in_rotation[i] = _pos_pins[i] > DRV7SEGQ595_POS_PIN_INITIAL && (skip == false || pos_lit[i]);
+    }
+
+    uint8_t in_rotation_count = skip ? lit_count : configured_count;
+
+    // The effective retention only depends on the counts, so it's left alone unless either of them changes.
+    if (in_rotation_count != _pos_in_rotation_count || configured_count != _pos_configured_count) {
+        _pos_in_rotation_count = in_rotation_count;
+        _pos_configured_count  = configured_count;
+        update_effective_retention();
+    }
+}
+
+void Drv7SegQ595Class::update_effective_retention()
+{
+    // Stretch the slots of the remaining positions to keep the frame period constant.
+    if (_pos_in_rotation_count > 0 && _pos_in_rotation_count != _pos_configured_count) {
+        _anti_ghosting_effective_retention_duration = _anti_ghosting_retention_duration * _pos_configured_count /
+                                                      _pos_in_rotation_count;
+    } else {
+        _anti_ghosting_effective_retention_duration = _anti_ghosting_retention_duration;
+    }
+    _anti_ghosting_effective_retention_ticks = micros_to_ticks(_anti_ghosting_effective_retention_duration);
+    update_overhead_compensation();
+}
+
+void Drv7SegQ595Class::update_overhead_compensation()
+{
+    /* The skipped slots would have taken their overhead (shifting and switching) too,
+     * so hand it over to the remaining ones as well.
+     */
+    if (_pos_in_rotation_count > 0 && _pos_in_rotation_count != _pos_configured_count) {
+        _anti_ghosting_overhead_compensation_ticks = _slot_overhead_ticks *
+                                                     (_pos_configured_count - _pos_in_rotation_count) /
+                                                     _pos_in_rotation_count;
+    } else {
+        _anti_ghosting_overhead_compensation_ticks = 0;
+    }
+}
+
+void Drv7SegQ595Class::frame_complete(uint32_t current_ticks)
+{
+    // The first slot only starts the measurement.
+    if (_duty_pos_on) {
+        _duty_last_frame_ticks = current_ticks - _duty_frame_start_ticks;
+        for (size_t i = 0; i < DRV7SEGQ595_POS_MAX; ++i) {
+            _duty_last_frame_pos_on_ticks[i] = _duty_pos_on_ticks[i];
+        }
+
+        _slot_overhead_ticks = _slot_overhead_ticks_sum / _frame_slot_count;
+        update_overhead_compensation();
+    }
+
+    for (size_t i = 0; i < DRV7SEGQ595_POS_MAX; ++i) {
+        _duty_pos_on_ticks[i] = 0;
+    }
+    _duty_frame_start_ticks  = current_ticks;
+    _slot_overhead_ticks_sum = 0;
+    _frame_slot_count        = 0;
+}
+
+void Drv7SegQ595Class::blink_timer(uint32_t current_ticks)
+{
+    if (_blink_half_period_ticks == 0) {
+        _blink_phase_off = false;
+        return;
+    }
+
+    uint32_t elapsed = current_ticks - _blink_timer_previous_ticks;
+    if (elapsed < _blink_half_period_ticks) {
+        return;
+    }
+
+    _blink_phase_off = !_blink_phase_off;
+
+    /* Advance by a whole half-period to keep the blink period free of accumulated jitter,
+     * unless the output has been stalled for longer than that.
+     */
+    if (elapsed < _blink_half_period_ticks * 2) {
+        _blink_timer_previous_ticks += _blink_half_period_ticks;
+    } else {
+        _blink_timer_previous_ticks = current_ticks;
+    }
+}
+
+void Drv7SegQ595Class::timebase_init()
+{
+    #if defined(DRV7SEGQ595_TIMEBASE_AVR_TIMER0)
+        _timebase_ticks_per_ms = F_CPU / DRV7SEGQ595_TIMEBASE_AVR_TIMER0_PRESCALER / DRV7SEGQ595_MICROS_IN_MILLI;
+    #elif defined(DRV7SEGQ595_TIMEBASE_ESP32_CYCLE_COUNT)
+        _timebase_ticks_per_ms = getCpuFrequencyMhz() * DRV7SEGQ595_MICROS_IN_MILLI;
+    #elif defined(DRV7SEGQ595_TIMEBASE_CORTEX_M_DWT)
+        DRV7SEGQ595_DEMCR    |= DRV7SEGQ595_DEMCR_TRCENA;
+        DRV7SEGQ595_DWT_LAR   = DRV7SEGQ595_DWT_LAR_UNLOCK_KEY;
+        DRV7SEGQ595_DWT_CTRL |= DRV7SEGQ595_DWT_CTRL_CYCCNTENA;
+        #ifdef F_CPU
+        _timebase_ticks_per_ms = F_CPU / DRV7SEGQ595_MICROS_IN_MILLI;
+        #else
+        _timebase_ticks_per_ms = SystemCoreClock / DRV7SEGQ595_MICROS_IN_MILLI;
+        #endif
+    #else  // RP2040 timer and micros() both run at 1 MHz.
+        _timebase_ticks_per_ms = DRV7SEGQ595_MICROS_TICKS_PER_SEC / DRV7SEGQ595_MICROS_IN_MILLI;
+    #endif
+}
+
+uint32_t Drv7SegQ595Class::timebase_ticks()
+{
+    if (_timebase_ticks_func != nullptr) {
+        return _timebase_ticks_func();
+    }
+
+    #if defined(DRV7SEGQ595_TIMEBASE_AVR_TIMER0)
+        /* Same reading sequence as in micros() (see wiring.c), minus the conversion to microseconds.
+         * Interrupts are disabled for the reading, and an overflow that has happened but hasn't been
+         * counted yet (the interrupt is pending) is accounted for, so the result never goes backwards,
+         * even if this method is called with interrupts disabled (e.g. from an ISR).
+         */
+        uint8_t sreg = SREG;
+        cli();
+
+        uint32_t overflow_count = timer0_overflow_count;
+        uint8_t  timer_count    = TCNT0;
+        if ((TIFR0 & _BV(TOV0)) && timer_count < UINT8_MAX) {
+            ++overflow_count;
+        }
+
+        SREG = sreg;
+
+        return (overflow_count << DRV7SEGQ595_BITS_IN_BYTE) | timer_count;
+    #elif defined(DRV7SEGQ595_TIMEBASE_ESP32_CYCLE_COUNT)
+        #if ESP_IDF_VERSION_MAJOR >= 5
+        return esp_cpu_get_cycle_count();
+        #else
+        return esp_cpu_get_ccount();
+        #endif
+    #elif defined(DRV7SEGQ595_TIMEBASE_RP2040_TIMER)
+        return time_us_32();
+    #elif defined(DRV7SEGQ595_TIMEBASE_CORTEX_M_DWT)
+        return DRV7SEGQ595_DWT_CYCCNT;
+    #else
+        return micros();
+    #endif
+}
+
+uint32_t Drv7SegQ595Class::micros_to_ticks(uint32_t duration)
+{
+    // Split to avoid both overflow and 64-bit arithmetic.
+    return duration / DRV7SEGQ595_MICROS_IN_MILLI * _timebase_ticks_per_ms +
+           duration % DRV7SEGQ595_MICROS_IN_MILLI * _timebase_ticks_per_ms / DRV7SEGQ595_MICROS_IN_MILLI;
+}
 
 bool Drv7SegQ595Class::anti_ghosting_timer()
 {
@@ -408,9 +1079,10 @@ bool Drv7SegQ595Class::anti_ghosting_timer()
                        */
     }
 
-    uint32_t current_micros = micros();
+    uint32_t current_ticks = timebase_ticks();
 
-    if (current_micros - _anti_ghosting_timer_previous_micros >= _anti_ghosting_retention_duration) {
+    if (current_ticks - _anti_ghosting_timer_previous_ticks >= _anti_ghosting_effective_retention_ticks +
+                                                               _anti_ghosting_overhead_compensation_ticks) {
         return true;   // The timer has elapsed.
     } else {
         return false;  // The timer hasn't elapsed yet.
@@ -422,10 +1094,14 @@ Drv7SegQ595Class::Pos Drv7SegQ595Class::anti_ghosting_next_pos_to_output()
     // Subtract 1 because positions are 1-indexed while array members are 0-indexed.
     size_t pos_as_index = static_cast<size_t>(_anti_ghosting_retained_pos) - 1;
 
-    // Add 1 because we're checking the next position, not the current one.
-    for (size_t i = pos_as_index + 1; i < DRV7SEGQ595_POS_MAX; ++i) {
-        // Search for a position that is valid for output (that was assigned a valid controlling pin).
-        if (_pos_pins[i] > DRV7SEGQ595_POS_PIN_INITIAL) {
+    // Start with 1 because we're checking the next position, not the current one.
+    for (size_t n = 1; n <= DRV7SEGQ595_POS_MAX; ++n) {
+        size_t i = (pos_as_index + n) % DRV7SEGQ595_POS_MAX;
+
+        /* Search for a position that is in the rotation (that was assigned a valid controlling pin
+         * and isn't skipped as blank).
+         */
+        if (_pos_in_rotation[i]) {
             // Add 1 because we're hopping back from 0-indexed to 1-indexed.
             return static_cast<Pos>(i + 1);
         }
@@ -37,11 +37,60 @@
  */
 #define DRV7SEGQ595_SPI_PROVIDED_ASSUMED
 
+/* Uncomment to build the footprint-minimized profile intended for small AVR targets
+ * (ATtiny, ATmega328P and alike). Can also be defined via build flags.
+ *
+ * The profile:
+ * - packs pin numbers and status codes into 8-bit fields (pin numbers above 127 aren't supported).
+ * - keeps a single data transfer variant (see below), other begin_*() methods aren't compiled.
+ * - strips redundant parameter validation (protection from unexpected casts and
+ *   position-control pins duplication check).
+ * The public API stays source-compatible otherwise.
+ */
+//#define DRV7SEGQ595_FOOTPRINT_MINIMIZED
+
+#ifdef DRV7SEGQ595_FOOTPRINT_MINIMIZED
+    /* Data transfer variant kept by the footprint-minimized profile.
+     * Use one variant, comment out or delete the others (or define one via build flags).
+     */
+    #if !defined(DRV7SEGQ595_FOOTPRINT_KEEP_BIT_BANGING) && \
+        !defined(DRV7SEGQ595_FOOTPRINT_KEEP_SPI)         && \
+        !defined(DRV7SEGQ595_FOOTPRINT_KEEP_USART_SPI)
+        #define DRV7SEGQ595_FOOTPRINT_KEEP_BIT_BANGING
+        //#define DRV7SEGQ595_FOOTPRINT_KEEP_SPI
+        //#define DRV7SEGQ595_FOOTPRINT_KEEP_USART_SPI
+    #endif
+#endif
+
+/* Uncomment to make the driver's timebase rely on micros() regardless of the hardware platform.
+ *
+ * Otherwise a cheaper native counter is used where one is known to be available:
+ * - Timer0 counter (extended by the Arduino core's overflow counter) on AVR MCs supported by the Arduino AVR core.
+ * - CPU cycle counter on ESP32 MCs.
+ * - 1 MHz system timer on RP2040 MCs.
+ * - DWT cycle counter on Cortex-M3/M4/M7 MCs.
+ *
+ * The tick rate of the cycle counters is read once, during the driver configuration (from getCpuFrequencyMhz()
+ * on ESP32, F_CPU or SystemCoreClock on Cortex-M). If the application changes the CPU clock afterwards
+ * (e.g. with setCpuFrequencyMhz() or dynamic frequency scaling), call set_timebase(nullptr, 0) to re-derive it.
+ * On Cortex-M this only helps where the rate comes from SystemCoreClock (call SystemCoreClockUpdate() first
+ * if the core doesn't keep it up to date); F_CPU is a build-time constant, so with clock changes rather use
+ * micros() (see above) or a custom timebase.
+ */
+//#define DRV7SEGQ595_TIMEBASE_MICROS
+
 /* Duration (in microseconds) of a short period during which
  * a currently output glyph is retained on a respective character position.
  */
 #define DRV7SEGQ595_ANTI_GHOSTING_DEFAULT_RETENTION_DURATION 600
 
+/* Duration (in milliseconds) of a full blink cycle (ON and OFF halves)
+ * applied to the segments specified by set_blink_to_pos().
+ */
+#define DRV7SEGQ595_BLINK_DEFAULT_PERIOD 1000
+
+#define DRV7SEGQ595_MICROS_IN_MILLI 1000
+
 #define DRV7SEGQ595_POS_MIN 1
 #define DRV7SEGQ595_POS_MAX 4
 
@@ -60,6 +109,7 @@
 #define DRV7SEGQ595_STATUS_ERR_INVALID_POS_SWITCH_TYPE -3
 #define DRV7SEGQ595_STATUS_ERR_INVALID_POS_PIN         -4
 #define DRV7SEGQ595_STATUS_ERR_POS_PIN_DUPLICATION     -5
+#define DRV7SEGQ595_STATUS_ERR_INVALID_USART           -8  // -6 and -7 are taken by the methods' additional codes.
 #define DRV7SEGQ595_STATUS_OK                           0
 
 // set_glyph_to_pos() method additional return codes.
@@ -67,13 +117,36 @@
 #define DRV7SEGQ595_SET_GLYPH_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS -7
 #define DRV7SEGQ595_SET_GLYPH_OK                                 0
 
+// set_*_to_pos() position attribute methods additional return codes.
+#define DRV7SEGQ595_SET_ATTR_ERR_INVALID_POS                   -6
+#define DRV7SEGQ595_SET_ATTR_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS -7
+#define DRV7SEGQ595_SET_ATTR_OK                                 0
+
+// get_slot_share_of_pos() method additional return codes.
+#define DRV7SEGQ595_GET_SLOT_SHARE_ERR_INVALID_POS                   -6
+#define DRV7SEGQ595_GET_SLOT_SHARE_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS -7
+
+#define DRV7SEGQ595_SLOT_SHARE_FULL 1000  // Slot share is reported in per mille of the frame period.
+
+// get_duty_of_pos() method additional return codes.
+#define DRV7SEGQ595_GET_DUTY_ERR_INVALID_POS                   -6
+#define DRV7SEGQ595_GET_DUTY_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS -7
+
+#define DRV7SEGQ595_DUTY_FULL 1000  // Duty is reported in per mille of the measured frame period.
+
 // output() method additional return codes.
 #define DRV7SEGQ595_OUTPUT_ERR_INVALID_POS                   -6
 #define DRV7SEGQ595_OUTPUT_ERR_POS_PIN_NOT_SPECIFIED_FOR_POS -7
 #define DRV7SEGQ595_OUTPUT_NEXT                               0
 #define DRV7SEGQ595_OUTPUT_ANTI_GHOSTING_RETENTION_RUNNING    1
 
-#if defined(DRV7SEGQ595_SPI_PROVIDED_ASSUMED)  || \
+#if !defined(DRV7SEGQ595_FOOTPRINT_MINIMIZED) || defined(DRV7SEGQ595_FOOTPRINT_KEEP_BIT_BANGING)
+    #define DRV7SEGQ595_BIT_BANGING_PROVIDED
+#endif
+
+#if defined(DRV7SEGQ595_FOOTPRINT_MINIMIZED) && !defined(DRV7SEGQ595_FOOTPRINT_KEEP_SPI)
+    // SPI variants are stripped by the footprint-minimized profile.
+#elif defined(DRV7SEGQ595_SPI_PROVIDED_ASSUMED)  || \
     defined(ARDUINO_ARCH_AVR)                  || \
     defined(ARDUINO_ARCH_MEGAAVR)              || \
     defined(ARDUINO_ARCH_SAM)                  || \
@@ -88,16 +161,75 @@
     #define DRV7SEGQ595_SPI_PROVIDED
 #endif
 
-#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_STM32)
+#if defined(DRV7SEGQ595_SPI_PROVIDED) && (defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_STM32))
     #define DRV7SEGQ595_SPI_PROVIDED_CUSTOM_PINS
 #endif
 
+#if (!defined(DRV7SEGQ595_FOOTPRINT_MINIMIZED) || defined(DRV7SEGQ595_FOOTPRINT_KEEP_USART_SPI)) && \
+    defined(ARDUINO_ARCH_AVR) && (defined(UCSR0A) || defined(UCSR1A))
+    #define DRV7SEGQ595_USART_SPI_PROVIDED
+#endif
+
+#ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+    // Bits of the USART registers in the Master SPI mode (identical for every USART instance).
+    #define DRV7SEGQ595_USART_UCSRA_TXC   6
+    #define DRV7SEGQ595_USART_UCSRA_UDRE  5
+    #define DRV7SEGQ595_USART_UCSRB_TXEN  3
+    #define DRV7SEGQ595_USART_UCSRC_UMSEL 6  // Both UMSELn1 and UMSELn0 bits must be set.
+    #define DRV7SEGQ595_USART_UCSRC_UDORD 2  // Cleared for MSB first.
+    #define DRV7SEGQ595_USART_UCSRC_UCPHA 1  // Cleared (along with UCPOLn) for SPI mode 0.
+    #define DRV7SEGQ595_USART_UCSRC_UCPOL 0
+
+    #define DRV7SEGQ595_USART_UCSRC_MSPIM_MODE_0_MSB_FIRST (0x03u << DRV7SEGQ595_USART_UCSRC_UMSEL)
+
+    /* Baud rate register value: XCK frequency equals F_CPU / (2 * (UBRR + 1)).
+     * The default corresponds to F_CPU / 4, same as the default AVR SPI clock.
+     */
+    #define DRV7SEGQ595_USART_SPI_UBRR 1
+#endif
+
+// Native timebase selection.
+#if defined(DRV7SEGQ595_TIMEBASE_MICROS)
+    // Forced by the library user.
+#elif defined(ARDUINO_ARCH_AVR) && (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__)  || \
+                                    defined(__AVR_ATmega168__)  || defined(__AVR_ATmega2560__) || \
+                                    defined(__AVR_ATmega1280__) || defined(__AVR_ATmega32U4__))
+    #define DRV7SEGQ595_TIMEBASE_AVR_TIMER0
+    #define DRV7SEGQ595_TIMEBASE_AVR_TIMER0_PRESCALER 64  // As set by the Arduino AVR core.
+#elif defined(ARDUINO_ARCH_ESP32)
+    #define DRV7SEGQ595_TIMEBASE_ESP32_CYCLE_COUNT
+#elif defined(ARDUINO_ARCH_RP2040)
+    #define DRV7SEGQ595_TIMEBASE_RP2040_TIMER
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    #define DRV7SEGQ595_TIMEBASE_CORTEX_M_DWT
+#else
+    #define DRV7SEGQ595_TIMEBASE_MICROS
+#endif
+
+#ifdef DRV7SEGQ595_TIMEBASE_CORTEX_M_DWT
+    // Core debug registers (identical across Cortex-M3/M4/M7 MCs).
+    #define DRV7SEGQ595_DEMCR                (*reinterpret_cast<volatile uint32_t *>(0xE000EDFCu))
+    #define DRV7SEGQ595_DEMCR_TRCENA         (1u << 24)
+    #define DRV7SEGQ595_DWT_CTRL             (*reinterpret_cast<volatile uint32_t *>(0xE0001000u))
+    #define DRV7SEGQ595_DWT_CTRL_CYCCNTENA   1u
+    #define DRV7SEGQ595_DWT_CYCCNT           (*reinterpret_cast<volatile uint32_t *>(0xE0001004u))
+    #define DRV7SEGQ595_DWT_LAR              (*reinterpret_cast<volatile uint32_t *>(0xE0001FB0u))
+    #define DRV7SEGQ595_DWT_LAR_UNLOCK_KEY   0xC5ACCE55u  // Required by some Cortex-M7 MCs.
+#endif
+
+#define DRV7SEGQ595_MICROS_TICKS_PER_SEC 1000000u
+
 // Driver configuration variant codes.
 #define DRV7SEGQ595_VARIANT_INITIAL     -1
-#define DRV7SEGQ595_VARIANT_BIT_BANGING  0
+#ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+    #define DRV7SEGQ595_VARIANT_BIT_BANGING  0
+#endif
 #ifdef DRV7SEGQ595_SPI_PROVIDED
     #define DRV7SEGQ595_VARIANT_SPI      1
 #endif
+#ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+    #define DRV7SEGQ595_VARIANT_USART_SPI 2
+#endif
 
 
 /****************** DATA TYPES ******************/
@@ -106,12 +238,23 @@ class Drv7SegQ595Class {
     public:
         /*--- Data types ---*/
 
-        enum class PosSwitchType {
+        // Status and return codes, digital GPIO pin numbers and position-control pin numbers.
+        #ifdef DRV7SEGQ595_FOOTPRINT_MINIMIZED
+        typedef int8_t   Status;
+        typedef uint8_t  Pin;
+        typedef int8_t   PosPin;
+        #else
+        typedef int32_t  Status;
+        typedef uint32_t Pin;
+        typedef int32_t  PosPin;
+        #endif
+
+        enum class PosSwitchType : uint8_t {
             ActiveLow  = 0,
             ActiveHigh = 1
         };
 
-        enum class Pos {
+        enum class Pos : uint8_t {
             Pos1 =  DRV7SEGQ595_POS_MIN,  // 1
             Pos2 =  2,
             Pos3 =  3,
@@ -138,16 +281,20 @@ class Drv7SegQ595Class {
          *                                    (respective parameters can be omitted).
          *
          * Multiple calls to this method are valid, each call leads to a fresh configuration.
+         *
+         * Not compiled by the footprint-minimized profile unless bit-banging is the kept variant.
          */
-        int32_t begin_bb(PosSwitchType pos_switch_type,
-                         uint32_t data_pin,
-                         uint32_t latch_pin,
-                         uint32_t clock_pin,
-                         int32_t pos_1_pin,
-                         int32_t pos_2_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                         int32_t pos_3_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                         int32_t pos_4_pin = DRV7SEGQ595_POS_PIN_INITIAL
-                        );
+        #ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
+        Status begin_bb(PosSwitchType pos_switch_type,
+                        Pin data_pin,
+                        Pin latch_pin,
+                        Pin clock_pin,
+                        PosPin pos_1_pin,
+                        PosPin pos_2_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                        PosPin pos_3_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                        PosPin pos_4_pin = DRV7SEGQ595_POS_PIN_INITIAL
+                       );
+        #endif
 
         /* Configure the driver to use SPI with default pins.
          *
@@ -163,13 +310,13 @@ class Drv7SegQ595Class {
          * Safety of multiple calls to this method depends on the SPI.h implementation.
          */
         #ifdef DRV7SEGQ595_SPI_PROVIDED
-        int32_t begin_spi(PosSwitchType pos_switch_type,
-                          uint32_t latch_pin,
-                          int32_t pos_1_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                          int32_t pos_2_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                          int32_t pos_3_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                          int32_t pos_4_pin = DRV7SEGQ595_POS_PIN_INITIAL
-                         );
+        Status begin_spi(PosSwitchType pos_switch_type,
+                         Pin latch_pin,
+                         PosPin pos_1_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                         PosPin pos_2_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                         PosPin pos_3_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                         PosPin pos_4_pin = DRV7SEGQ595_POS_PIN_INITIAL
+                        );
         #endif
 
         /* Configure the driver to use SPI with custom-assigned pins.
@@ -186,15 +333,46 @@ class Drv7SegQ595Class {
          * Safety of multiple calls to this method depends on the SPI.h implementation.
          */
         #ifdef DRV7SEGQ595_SPI_PROVIDED_CUSTOM_PINS
-        int32_t begin_spi_custom_pins(PosSwitchType pos_switch_type,
-                                      uint32_t mosi_pin,
-                                      uint32_t latch_pin,
-                                      uint32_t sck_pin,
-                                      int32_t pos_1_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                                      int32_t pos_2_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                                      int32_t pos_3_pin = DRV7SEGQ595_POS_PIN_INITIAL,
-                                      int32_t pos_4_pin = DRV7SEGQ595_POS_PIN_INITIAL
-                                     );
+        Status begin_spi_custom_pins(PosSwitchType pos_switch_type,
+                                     Pin mosi_pin,
+                                     Pin latch_pin,
+                                     Pin sck_pin,
+                                     PosPin pos_1_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                                     PosPin pos_2_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                                     PosPin pos_3_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                                     PosPin pos_4_pin = DRV7SEGQ595_POS_PIN_INITIAL
+                                    );
+        #endif
+
+        /* Configure the driver to use an AVR USART in the Master SPI mode.
+         *
+         * Returns: equivalent to begin_bb() and begin_spi(), plus
+         * DRV7SEGQ595_STATUS_ERR_INVALID_USART if the specified USART isn't present on the MC.
+         *
+         * Parameters: mostly equivalent to begin_bb(), but
+         * data_pin is replaced with usart_num and clock_pin is replaced with xck_pin.
+         * - usart_num - number of the USART instance (0 for USART0, 1 for USART1 and so on).
+         *               Its TXDn pin becomes the data pin.
+         * - xck_pin   - the XCKn pin of the same USART instance as per the pin numbering
+         *               provided by your Arduino core (e.g. 4 for USART0 of ATmega328P).
+         *
+         * Gives near-SPI shifting speed while leaving the hardware SPI pins free.
+         * The USART cannot be used as a serial port (e.g. by Serial) at the same time.
+         *
+         * This method is only available (via conditional compilation) for AVR MCs that have a USART.
+         *
+         * Multiple calls to this method are valid, each call leads to a fresh configuration.
+         */
+        #ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+        Status begin_usart_spi(PosSwitchType pos_switch_type,
+                               uint8_t usart_num,
+                               Pin latch_pin,
+                               Pin xck_pin,
+                               PosPin pos_1_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                               PosPin pos_2_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                               PosPin pos_3_pin = DRV7SEGQ595_POS_PIN_INITIAL,
+                               PosPin pos_4_pin = DRV7SEGQ595_POS_PIN_INITIAL
+                              );
         #endif
 
         /* Get the last driver configuration status.
@@ -202,7 +380,7 @@ class Drv7SegQ595Class {
          * Returns: zero if driver configuration was successful, a negative integer otherwise
          * (see the preprocessor macros list for possible values).
          */
-        int32_t get_status();
+        Status get_status();
 
         /* Assign a glyph to be output on a specified position.
          *
@@ -216,7 +394,65 @@ class Drv7SegQ595Class {
          * - pos      - a number of the character position (digit) the next glyph
          *              must be output on.
          */
-        int32_t set_glyph_to_pos(uint8_t seg_byte, Pos pos);
+        Status set_glyph_to_pos(uint8_t seg_byte, Pos pos);
+
+        /* Position attributes.
+         *
+         * Attributes are stored per position alongside the assigned glyphs and are applied
+         * to the seg_byte right before it's shifted into the IC, so the glyphs themselves
+         * don't need to be regenerated and reassigned in order to blink or modify them.
+         * Attributes are applied in the following order: forced segments, inverted segments,
+         * blink, blank.
+         *
+         * All set_*_to_pos() attribute methods return:
+         * - a negative integer if driver configuration had failed or not all passed parameters are valid
+         *   (see the preprocessor macros list for possible values).
+         * - zero if the attribute was successfully assigned.
+         *
+         * Attributes persist through driver reconfiguration. Passing zero masks (or false)
+         * clears respective attributes.
+         */
+
+        /* Make the segments specified by blink_mask blink (periodically turn OFF).
+         *
+         * Parameters:
+         * - blink_mask           - set bits correspond to the seg_byte bits that must blink.
+         * - pos                  - a number of the character position (digit) the attribute applies to.
+         * - blink_phase_inverted - if true, the segments are OFF during the half-period
+         *                          when the non-inverted ones are ON and vice versa.
+         */
+        Status set_blink_to_pos(uint8_t blink_mask, Pos pos, bool blink_phase_inverted = false);
+
+        /* Force the segments specified by forced_mask to stay ON regardless of
+         * the assigned glyph (e.g. a dot segment, also known as a decimal point or DP).
+         */
+        Status set_forced_segments_to_pos(uint8_t forced_mask, Pos pos);
+
+        /* Invert (toggle ON or OFF) the segments specified by inverted_mask. */
+        Status set_inverted_segments_to_pos(uint8_t inverted_mask, Pos pos);
+
+        /* Turn OFF all segments of a position regardless of the assigned glyph and other attributes. */
+        Status set_blank_to_pos(bool blank, Pos pos);
+
+        /* Set new blink period.
+         *
+         * Sets the duration (in milliseconds) of a full blink cycle (ON and OFF halves).
+         * Until this method is called, the default value is applied.
+         * Blink timing is driven by the same timebase as the anti-ghosting logic (see set_timebase()).
+         *
+         * Returns: nothing.
+         */
+        void set_blink_period(uint32_t new_val);
+
+        /* Set the seg_byte that turns all segments OFF.
+         *
+         * Depends on the display type: 0x00 for a common-cathode display (default),
+         * 0xFF for a common-anode display. Used to determine which level turns
+         * a segment OFF when the position attributes are applied.
+         *
+         * Returns: nothing.
+         */
+        void set_blank_glyph(uint8_t seg_byte);
 
         /* Output a glyph on a specified character position.
          *
@@ -224,9 +460,14 @@ class Drv7SegQ595Class {
          * - one blank byte for anti-ghosting purposes.
          * - one byte of payload (seg_byte).
          * After every single byte latches the data into the IC's outer register.
+         * With pipelined shifting (see set_pipelined_shifting()) only latches the data
+         * if it was preloaded during the previous retention period.
          *
          * Turns digital pins that control switching transistors ON or OFF according to the specified position.
          *
+         * Attributes assigned to the specified position (see set_*_to_pos() attribute methods)
+         * are applied to seg_byte before shifting.
+         *
          * Returns:
          * - a negative integer if driver configuration had failed or not all passed parameters are valid
          *   (see the preprocessor macros list for possible values).
@@ -238,11 +479,13 @@ class Drv7SegQ595Class {
          * - pos      - a number of the character position (digit) the next glyph
          *              must be output on.
          */
-        int32_t output(uint8_t seg_byte,
-                       Pos pos
-                      );
+        Status output(uint8_t seg_byte,
+                      Pos pos
+                     );
 
         /* Output the glyphs assigned to each valid character position in quick succession.
+         *
+         * Positions skipped as blank (see set_blank_pos_skipping()) aren't output.
          *
          * Returns: nothing.
          */
@@ -258,42 +501,213 @@ class Drv7SegQ595Class {
          */
         void set_anti_ghosting_retention_duration(uint32_t new_val);
 
+        /* Enable or disable blank positions skipping.
+         *
+         * When enabled, positions whose glyph turns all segments OFF (as per set_blank_glyph()),
+         * taking the forced and inverted segments into account, or which are blanked with
+         * set_blank_to_pos(), are removed from the multiplexing rotation. The time freed is
+         * redistributed among the remaining (lit) positions so that the frame period stays
+         * constant and the lit positions appear brighter: besides the retention, the lit slots
+         * take over the time the skipped ones would have spent on shifting the data and switching
+         * the pins (as measured by output() over the last frame). With zero retention duration
+         * the frame period isn't kept constant. Blinking segments don't affect the rotation.
+         * Applies to the glyphs assigned with set_glyph_to_pos() (see output_all()).
+         *
+         * Disabled by default.
+         *
+         * Returns: nothing.
+         */
+        void set_blank_pos_skipping(bool enabled);
+
+        /* Enable or disable pipelined shifting.
+         *
+         * When enabled, the seg_byte of the position to be output next is shifted into the IC
+         * during the current retention period, without being latched. When the slot changes,
+         * only the position-control pins have to be switched and the data latched, so the display
+         * stays dark for a much shorter time, which increases brightness and allows for higher
+         * refresh rates. With the USART in SPI mode variant the preloaded byte is shifted
+         * by the hardware in the background.
+         *
+         * The preloaded seg_byte is based on the glyphs assigned with set_glyph_to_pos(), so the gain
+         * applies to output_all(). If the glyph passed to output() or its attributes differ from
+         * the preloaded ones by the time of the slot change, the data is shifted in full as usual.
+         *
+         * The 74HC595 has no chip select input, so if its data and clock lines are shared with other
+         * devices (e.g. an SD card or a radio module on the SPI bus), their traffic overwrites the preloaded
+         * data in the IC's shift register unnoticed. Call discard_pipelined_preload() after every
+         * transaction with another device on the shared lines, otherwise garbage gets latched and output
+         * for a whole slot.
+         *
+         * Disabled by default.
+         *
+         * Returns: nothing.
+         */
+        void set_pipelined_shifting(bool enabled);
+
+        /* Discard the data preloaded by pipelined shifting, so the next slot gets shifted in full.
+         *
+         * Must be called after any other traffic on the data and clock lines shared with the IC
+         * (see set_pipelined_shifting()). Does nothing harmful if pipelined shifting is disabled.
+         *
+         * Returns: nothing.
+         */
+        void discard_pipelined_preload();
+
+        /* Set a custom timebase for the anti-ghosting and blink logic.
+         *
+         * By default a cheap native counter is used (see the preprocessor macros list),
+         * falling back to micros(). A custom timebase may be e.g. a mock counter in host tests
+         * or a hardware timer the application already runs.
+         *
+         * Durations set in microseconds and milliseconds are converted to native ticks once,
+         * when they're set (or when the timebase changes), so the timer polling only involves
+         * reading the counter and comparing the values.
+         *
+         * Parameters:
+         * - ticks_func    - a function that returns a free-running 32-bit tick counter that wraps
+         *                   around at 2^32. Passing nullptr reverts to the native timebase and re-derives
+         *                   its tick rate, which is necessary after the CPU clock has been changed
+         *                   if the native timebase is a cycle counter (ESP32, Cortex-M).
+         * - ticks_per_sec - tick rate. Must be a multiple of 1000. Ignored if ticks_func is nullptr.
+         *
+         * With fast counters (e.g. CPU cycle counters) mind that the durations converted to ticks
+         * must stay below 2^31 ticks (e.g. about 8.9 seconds at 240 MHz).
+         *
+         * Returns: nothing.
+         */
+        void set_timebase(uint32_t (*ticks_func)(), uint32_t ticks_per_sec);
+
+        /* Get the nominal slot share of a position.
+         *
+         * Returns:
+         * - a negative integer if driver configuration had failed or not all passed parameters are valid
+         *   (see the preprocessor macros list for possible values).
+         * - otherwise, the share of the frame period allocated to the position's slot by the multiplexing
+         *   rotation, in per mille (0 to DRV7SEGQ595_SLOT_SHARE_FULL), i.e. zero for a position skipped
+         *   as blank and an equal share for every position in the rotation.
+         *
+         * The value is derived from the rotation, not measured. The actual on-time is somewhat shorter
+         * (the position is dark while the data is shifted, less so with pipelined shifting) and, with
+         * zero retention duration, depends on how often output() or output_all() is called; see
+         * get_duty_of_pos() for the measured value.
+         *
+         * Parameters:
+         * - pos - a number of the character position (digit).
+         */
+        int16_t get_slot_share_of_pos(Pos pos);
+
+        /* Get the effective duty of a position, as measured by the driver.
+         *
+         * output() accounts the timebase ticks each position actually stays turned on for, from
+         * switching it on till switching all positions off for the next slot. The duty is the sum
+         * for the position over the last complete frame (a full cycle of the multiplexing rotation),
+         * divided by the duration of that frame. Unlike the slot share (see get_slot_share_of_pos()),
+         * it reflects the time spent on shifting the data and switching the pins, pipelined shifting,
+         * zero retention duration and the actual timing of the output() or output_all() calls,
+         * so it can be used to check brightness consistency across the positions.
+         *
+         * Returns:
+         * - a negative integer if driver configuration had failed or not all passed parameters are valid
+         *   (see the preprocessor macros list for possible values).
+         * - otherwise, the duty in per mille (0 to DRV7SEGQ595_DUTY_FULL), zero until the first frame
+         *   is complete. The measurement restarts on driver reconfiguration and timebase change.
+         *
+         * Parameters:
+         * - pos - a number of the character position (digit).
+         */
+        int16_t get_duty_of_pos(Pos pos);
+
     private:
         /*--- Variables ---*/
 
-        int32_t _status  = DRV7SEGQ595_STATUS_INITIAL;
-        int32_t _variant = DRV7SEGQ595_VARIANT_INITIAL;
+        Status _status  = DRV7SEGQ595_STATUS_INITIAL;
+        int8_t _variant = DRV7SEGQ595_VARIANT_INITIAL;
 
         PosSwitchType _pos_switch_type;
 
         // Used in all variants.
-        uint32_t _latch_pin;
+        Pin _latch_pin;
 
+        #ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
         // Used in the bit-banging variant.
-        uint32_t _data_pin;
-        uint32_t _clock_pin;
+        Pin _data_pin;
+        Pin _clock_pin;
+        #endif
 
         #ifdef DRV7SEGQ595_SPI_PROVIDED_CUSTOM_PINS
         // Used in the custom SPI pins variant.
-        uint32_t _mosi_pin;
-        uint32_t _sck_pin;
+        Pin _mosi_pin;
+        Pin _sck_pin;
+        #endif
+
+        #ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+        // Used in the USART in SPI mode variant.
+        volatile uint8_t *_usart_ucsra;
+        volatile uint8_t *_usart_udr;
+        bool              _usart_spi_pending = false;
         #endif
 
         // Digital GPIO pins that may correspond to the actual display character positions (digits).
-        int32_t _pos_pins[DRV7SEGQ595_POS_MAX] = {DRV7SEGQ595_POS_PIN_INITIAL,
-                                                   DRV7SEGQ595_POS_PIN_INITIAL,
-                                                   DRV7SEGQ595_POS_PIN_INITIAL,
-                                                   DRV7SEGQ595_POS_PIN_INITIAL
-                                                  };
+        PosPin _pos_pins[DRV7SEGQ595_POS_MAX] = {DRV7SEGQ595_POS_PIN_INITIAL,
+                                                  DRV7SEGQ595_POS_PIN_INITIAL,
+                                                  DRV7SEGQ595_POS_PIN_INITIAL,
+                                                  DRV7SEGQ595_POS_PIN_INITIAL
+                                                 };
 
         // Glyphs assigned to be output next.
         uint8_t _pos_glyphs[DRV7SEGQ595_POS_MAX] = {0};
 
+        // Attributes applied to the glyphs at output.
+        uint8_t _pos_blink_masks[DRV7SEGQ595_POS_MAX]          = {0};
+        bool    _pos_blink_phases_inverted[DRV7SEGQ595_POS_MAX] = {false};
+        uint8_t _pos_forced_masks[DRV7SEGQ595_POS_MAX]         = {0};
+        uint8_t _pos_inverted_masks[DRV7SEGQ595_POS_MAX]       = {0};
+        bool    _pos_blank[DRV7SEGQ595_POS_MAX]                = {false};
+
+        uint8_t _blank_glyph = DRV7SEGQ595_ALL_BITS_CLEARED_MASK;
+
+        // Elements of the timebase (see set_timebase()).
+        uint32_t (*_timebase_ticks_func)() = nullptr;
+        uint32_t _timebase_ticks_per_ms    = DRV7SEGQ595_MICROS_TICKS_PER_SEC / DRV7SEGQ595_MICROS_IN_MILLI;
+
+        // Elements of the blink logic.
+        uint32_t _blink_half_period = DRV7SEGQ595_BLINK_DEFAULT_PERIOD * DRV7SEGQ595_MICROS_IN_MILLI / 2;
+        uint32_t _blink_half_period_ticks   = _blink_half_period;
+        bool     _blink_phase_off           = false;
+        uint32_t _blink_timer_previous_ticks = 0;
+
         // Elements of the anti-ghosting logic.
         uint32_t _anti_ghosting_retention_duration = DRV7SEGQ595_ANTI_GHOSTING_DEFAULT_RETENTION_DURATION;
         bool     _anti_ghosting_first_output_call = true;
         Pos      _anti_ghosting_retained_pos;
-        uint32_t _anti_ghosting_timer_previous_micros;
+        uint32_t _anti_ghosting_timer_previous_ticks;
+
+        // Elements of the pipelined shifting logic.
+        bool    _pipelined_shifting           = false;
+        bool    _pipelined_preloaded          = false;
+        Pos     _pipelined_preloaded_pos      = Drv7SegQ595Class::Pos::Pos1;
+        uint8_t _pipelined_preloaded_seg_byte = 0;
+
+        // Elements of the multiplexing rotation (see set_blank_pos_skipping()).
+        bool     _blank_pos_skipping = false;
+        bool     _pos_in_rotation[DRV7SEGQ595_POS_MAX] = {false};
+        uint8_t  _pos_in_rotation_count = 0;
+        uint8_t  _pos_configured_count  = 0;
+        uint32_t _anti_ghosting_effective_retention_duration = DRV7SEGQ595_ANTI_GHOSTING_DEFAULT_RETENTION_DURATION;
+        uint32_t _anti_ghosting_effective_retention_ticks    = DRV7SEGQ595_ANTI_GHOSTING_DEFAULT_RETENTION_DURATION;
+
+        // Elements of the duty measurement (see get_duty_of_pos()).
+        bool     _duty_pos_on                                       = false;  // A position has been turned on.
+        uint32_t _duty_pos_on_ticks[DRV7SEGQ595_POS_MAX]            = {0};    // Current frame.
+        uint32_t _duty_last_frame_pos_on_ticks[DRV7SEGQ595_POS_MAX] = {0};
+        uint32_t _duty_frame_start_ticks                            = 0;
+        uint32_t _duty_last_frame_ticks                             = 0;
+
+        // Elements of the slot overhead measurement (see set_blank_pos_skipping()).
+        uint32_t _slot_overhead_ticks_sum                   = 0;  // Current frame.
+        uint8_t  _frame_slot_count                          = 0;  // Current frame.
+        uint32_t _slot_overhead_ticks                       = 0;  // Average per slot over the last frame.
+        uint32_t _anti_ghosting_overhead_compensation_ticks = 0;
 
 
         /*--- Methods ---*/
@@ -304,18 +718,18 @@ class Drv7SegQ595Class {
          * Returns: zero if the respective configuration stage was successful (if all passed parameters are
          * valid), a negative integer otherwise (see the preprocessor macros list for possible values).
          */
-        int32_t begin_helper(int32_t config_variant,
-                             PosSwitchType pos_switch_type,
-                             uint32_t latch_pin,
-
-                             int32_t pos_1_pin,
-                             /* Following parameters are assigned with values even if those were omitted
-                              * in a begin_*() method call (in this case default values are assigned).
-                              */
-                             int32_t pos_2_pin,
-                             int32_t pos_3_pin,
-                             int32_t pos_4_pin
-                            );
+        Status begin_helper(int8_t config_variant,
+                            PosSwitchType pos_switch_type,
+                            Pin latch_pin,
+
+                            PosPin pos_1_pin,
+                            /* Following parameters are assigned with values even if those were omitted
+                             * in a begin_*() method call (in this case default values are assigned).
+                             */
+                            PosPin pos_2_pin,
+                            PosPin pos_3_pin,
+                            PosPin pos_4_pin
+                           );
 
         /* Send a single byte to a shift register.
          *
@@ -328,7 +742,112 @@ class Drv7SegQ595Class {
          * thus in the first bit not getting shifted in case a clock pin is set to HIGH for some reason before
          * the shifting starts.
          */
+        #ifdef DRV7SEGQ595_BIT_BANGING_PROVIDED
         void shift_out(uint8_t byte_to_shift);
+        #endif
+
+        #ifdef DRV7SEGQ595_USART_SPI_PROVIDED
+        /* Put a single byte into the USART transmit buffer.
+         *
+         * Returns: nothing.
+         *
+         * Waits only until the transmit buffer is free, so the byte may be queued behind
+         * the previous one and may still be shifting when the method returns.
+         * Call usart_spi_wait() before latching.
+         */
+        void usart_spi_transfer(uint8_t byte_to_shift);
+
+        /* Wait until the last byte put into the USART transmit buffer is completely shifted out.
+         *
+         * Returns: nothing.
+         */
+        void usart_spi_wait();
+        #endif
+
+        /* Send a single byte to the shift register using the configured variant.
+         * Doesn't latch the data.
+         *
+         * Returns: nothing.
+         */
+        void transfer(uint8_t byte_to_shift);
+
+        /* Latch the data from the IC's shift register into its storage (output) register.
+         *
+         * Returns: nothing.
+         */
+        void latch();
+
+        /* Check if a position is valid for attribute assignment.
+         *
+         * Returns: zero if it is, a negative integer otherwise
+         * (see the preprocessor macros list for possible values).
+         */
+        Status attr_pos_check(Pos pos);
+
+        /* Apply the attributes assigned to a position to a seg_byte.
+         *
+         * Returns: the resulting seg_byte.
+         */
+        uint8_t apply_pos_attrs(uint8_t seg_byte, size_t pos_as_index);
+
+        /* Apply the forced and inverted segments attributes assigned to a position to a seg_byte.
+         *
+         * Returns: the resulting seg_byte.
+         */
+        uint8_t apply_static_pos_attrs(uint8_t seg_byte, size_t pos_as_index);
+
+        /* Recalculate the multiplexing rotation, and the effective retention duration if the number
+         * of positions in the rotation has changed. Must be called whenever anything the rotation
+         * depends on changes (the glyphs and attributes only matter if blank positions are skipped).
+         *
+         * Returns: nothing.
+         */
+        void update_rotation();
+
+        /* Recalculate the effective retention duration (and convert it to ticks) for the current rotation.
+         * Must be called whenever the retention duration or the timebase changes.
+         *
+         * Returns: nothing.
+         */
+        void update_effective_retention();
+
+        /* Recalculate the ticks added to the retention of every slot in the rotation to make up for
+         * the overhead (shifting and switching) of the skipped slots.
+         *
+         * Returns: nothing.
+         */
+        void update_overhead_compensation();
+
+        /* Complete a frame (a full cycle of the multiplexing rotation): publish the duty measurement
+         * of the frame and start the next one.
+         *
+         * Returns: nothing.
+         */
+        void frame_complete(uint32_t current_ticks);
+
+        /* Advance the blink timer and toggle the blink phase once per half-period.
+         *
+         * Returns: nothing.
+         */
+        void blink_timer(uint32_t current_ticks);
+
+        /* Prepare the native timebase (enable the counter if necessary, find out the tick rate).
+         *
+         * Returns: nothing.
+         */
+        void timebase_init();
+
+        /* Read the current timebase counter value.
+         *
+         * Returns: the current tick count.
+         */
+        uint32_t timebase_ticks();
+
+        /* Convert a duration in microseconds to timebase ticks.
+         *
+         * Returns: the duration in ticks.
+         */
+        uint32_t micros_to_ticks(uint32_t duration);
 
         /* Find out which character position (digit) must be turned on
          * next after the current retention period is over.